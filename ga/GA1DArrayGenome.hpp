@@ -10,12 +10,15 @@
 #include "GAArray.h"
 #include "GAGenome.h"
 #include "GAMask.h"
+#include <algorithm>
 #include <cstdio>
 #include <cstdlib>
 #include <cstring> 
 #include "garandom.h"
 #include <vector>
 #include <array>
+#include <functional>
+#include <type_traits>
 
 
 /** 1 dimensional Array Genome
@@ -59,15 +62,13 @@ template <class T> class GA1DArrayGenome : public GAArray<T>, public GAGenome
 		float nMut = pmut * STA_CAST(float, child.length());
 		int length = child.length() - 1;
 		if (nMut < 1.0)
-		{ // we have to do a flip test on each bit
+		{ // skip to each element that a flip test would pick
 			nMut = 0;
-			for (int i = length; i >= 0; i--)
+			for (int i = length - GARandomSkip(pmut); i >= 0;
+				 i -= GARandomSkip(pmut) + 1)
 			{
-				if (GAFlipCoin(pmut))
-				{
-					child.swap(i, GARandomInt(0, length));
-					nMut++;
-				}
+				child.swap(i, GARandomInt(0, length));
+				nMut++;
 			}
 		}
 		else
@@ -1004,11 +1005,75 @@ template <class T> class GA1DArrayGenome : public GAArray<T>, public GAGenome
 		return 0;
 	}
 
+	// Arrays of built-in types are encoded as the length and then the values.
+	// Any others fall back to the text of write() and read().  The length is
+	// taken as resize() would take it, except that one outside the limits of
+	// a resizable genome is refused rather than clipped.
+	void encodeGenes(GAEncoder &enc) const override
+	{
+		if constexpr (std::is_arithmetic<T>::value)
+		{
+			enc.u32(nx);
+			for (unsigned int i = 0; i < nx; i++)
+				enc.value(this->a[i]);
+		}
+		else
+		{
+			GAGenome::encodeGenes(enc);
+		}
+	}
+	bool decodeGenes(GADecoder &dec) override
+	{
+		if constexpr (std::is_arithmetic<T>::value)
+		{
+			std::uint32_t l;
+			if (!dec.u32(l) || (minX != maxX && (l < minX || l > maxX)) ||
+				dec.left() / sizeof(T) < l)
+				return dec.fail();
+			// not our virtual resize - an allele genome would pick alleles
+			// for the new elements
+			GA1DArrayGenome<T>::resize(l);
+			for (unsigned int i = 0; i < nx; i++)
+			{
+				T v{};
+				dec.value(v);
+				this->a[i] = v;
+			}
+			_evaluated = false;
+			return dec.ok();
+		}
+		else
+		{
+			return GAGenome::decodeGenes(dec);
+		}
+	}
+
 	bool equal(const GAGenome &c) const override
 	{
 		const GA1DArrayGenome<T> &b = DYN_CAST(const GA1DArrayGenome<T> &, c);
 		return ((this == &c) ? true	: ((nx != b.nx) ? 0 : GAArray<T>::equal(b, 0, 0, nx)));
 	}
+	bool identical(const GAGenome &c) const override
+	{
+		return c.classID() == classID() && equal(c);
+	}
+	// Only arrays of built-in types know how to hash their elements.
+	std::uint64_t hash() const override
+	{
+		if constexpr (std::is_arithmetic<T>::value)
+		{
+			std::uint64_t h = HashCombine(classID(), nx);
+			for (unsigned int i = 0; i < nx; i++)
+			{
+				h = HashCombine(h, std::hash<T>{}(this->a[i]));
+			}
+			return (h != 0 ? h : 1);
+		}
+		else
+		{
+			return 0;
+		}
+	}
 
 	const T &gene(unsigned int x = 0) const { return this->a[x]; }
 	T &gene(unsigned int x, const T &value)
@@ -1020,6 +1085,20 @@ template <class T> class GA1DArrayGenome : public GAArray<T>, public GAGenome
 		}
 		return this->a.at(x);
 	}
+	/// All the genes, one after the other, for operators that work on the
+	/// whole array at once.
+	const T *genes() const { return this->a.data(); }
+	/// Set the first n genes from v.  As with gene(x, value), the genome
+	/// needs evaluating again only if one of them changed.
+	void genes(const T *v, unsigned int n)
+	{
+		n = (n < nx ? n : nx);
+		if (!std::equal(v, v + n, this->a.begin()))
+		{
+			std::copy_n(v, n, this->a.begin());
+			_evaluated = false;
+		}
+	}
 	int length() const { return nx; }
 	int length(int x)
 	{
@@ -1179,6 +1258,12 @@ template <class T> class GA1DArrayAlleleGenome : public GA1DArrayGenome<T>
 	{
 		GA1DArrayAlleleGenome<T> &child = DYN_CAST(GA1DArrayAlleleGenome<T> &, c);
 		child.resize(GAGenome::ANY_SIZE); // let chrom resize if it can
+		if (child.size() == 1)
+		{ // one set for every element, so fill them all in one go
+			child.alleleset().alleles(child.a.data(), child.length());
+			child._evaluated = false;
+			return;
+		}
 		for (int i = child.length() - 1; i >= 0; i--)
 			child.gene(i, child.alleleset(i).allele());
 	}
@@ -1214,16 +1299,34 @@ template <class T> class GA1DArrayAlleleGenome : public GA1DArrayGenome<T>
 			return (0);
 
 		float nMut = pmut * STA_CAST(float, child.length());
-		if (nMut < 1.0)
-		{ // we have to do a flip test on each bit
+		if (child.size() == 1)
+		{ // one set for every element, so pick the elements then their alleles
+			std::vector<int> pick;
+			if (nMut < 1.0)
+			{
+				for (int i = child.length() - 1 - GARandomSkip(pmut); i >= 0;
+					 i -= GARandomSkip(pmut) + 1)
+					pick.push_back(i);
+				nMut = STA_CAST(float, pick.size());
+			}
+			else
+			{
+				for (int n = 0; n < nMut; n++)
+					pick.push_back(GARandomInt(0, child.length() - 1));
+			}
+			std::vector<T> v(pick.size());
+			child.alleleset().alleles(v.data(), STA_CAST(unsigned int, v.size()));
+			for (std::size_t j = 0; j < pick.size(); j++)
+				child.gene(pick[j], v[j]);
+		}
+		else if (nMut < 1.0)
+		{ // skip to each element that a flip test would pick
 			nMut = 0;
-			for (int i = child.length() - 1; i >= 0; i--)
+			for (int i = child.length() - 1 - GARandomSkip(pmut); i >= 0;
+				 i -= GARandomSkip(pmut) + 1)
 			{
-				if (GAFlipCoin(pmut))
-				{
-					child.gene(i, child.alleleset(i).allele());
-					nMut++;
-				}
+				child.gene(i, child.alleleset(i).allele());
+				nMut++;
 			}
 		}
 		else
@@ -1284,8 +1387,7 @@ template <class T> class GA1DArrayAlleleGenome : public GA1DArrayGenome<T>
 		return *this;
 	}
 
-	// Delete the allele set
-	~GA1DArrayAlleleGenome() override { delete[] aset; }
+	~GA1DArrayAlleleGenome() override = default;
 
 	// This implementation of clone does not make use of the contents/attributes
 	// capability because this whole interface isn't quite right yet...  Just
@@ -1341,7 +1443,11 @@ template <class T> class GA1DArrayAlleleGenome : public GA1DArrayGenome<T>
 	{
 		unsigned int oldx = this->nx;
 		GA1DArrayGenome<T>::resize(len);
-		if (this->nx > oldx)
+		if (this->nx > oldx && size() == 1)
+		{
+			aset.at(0).alleles(this->a.data() + oldx, this->nx - oldx);
+		}
+		else if (this->nx > oldx)
 		{
 			for (unsigned int i = oldx; i < this->nx; i++)
 				this->a.at(i) = aset.at(i % size()).allele();
@@ -64,7 +64,7 @@ class GA1DBinaryStringGenome : public GABinaryString, public GAGenome
 	}
 	GA1DBinaryStringGenome &operator=(const short array[]) // no err checks!
 	{
-		for (unsigned int i = 0; i < data.size(); i++)
+		for (unsigned int i = 0; i < static_cast<unsigned int>(size()); i++)
 		{
 			gene(i, *(array + i));
 		}
@@ -72,7 +72,7 @@ class GA1DBinaryStringGenome : public GABinaryString, public GAGenome
 	}
 	GA1DBinaryStringGenome &operator=(const int array[]) // no err checks!
 	{
-		for (unsigned int i = 0; i < data.size(); i++)
+		for (unsigned int i = 0; i < static_cast<unsigned int>(size()); i++)
 		{
 			gene(i, *(array + i));
 		}
@@ -84,8 +84,15 @@ class GA1DBinaryStringGenome : public GABinaryString, public GAGenome
 
 	int read(std::istream &is) override;
 	int write(std::ostream &os) const override;
+	void encodeGenes(GAEncoder &) const override;
+	bool decodeGenes(GADecoder &) override;
 
 	bool equal(const GAGenome &c) const override;
+	bool identical(const GAGenome &c) const override
+	{
+		return c.classID() == classID() && equal(c);
+	}
+	std::uint64_t hash() const override;
 
 	short gene(unsigned int x = 0) const { return bit(x); }
 	short gene(unsigned int x, short value)
@@ -39,15 +39,13 @@ template <class T> class GA2DArrayGenome : public GAArray<T>, public GAGenome
 		float nMut = pmut * STA_CAST(float, child.size());
 		int size = child.size() - 1;
 		if (nMut < 1.0)
-		{ // we have to do a flip test on each bit
+		{ // skip to each element that a flip test would pick
 			nMut = 0;
-			for (int i = size; i >= 0; i--)
+			for (int i = size - GARandomSkip(pmut); i >= 0;
+				 i -= GARandomSkip(pmut) + 1)
 			{
-				if (GAFlipCoin(pmut))
-				{
-					child.GAArray<T>::swap(i, GARandomInt(0, size));
-					nMut++;
-				}
+				child.GAArray<T>::swap(i, GARandomInt(0, size));
+				nMut++;
 			}
 		}
 		else
@@ -624,6 +622,48 @@ template <class T> class GA2DArrayGenome : public GAArray<T>, public GAGenome
 		return 0;
 	}
 
+	// As the 1D array genome, with the width and height and then the values
+	// row by row.
+	void encodeGenes(GAEncoder &enc) const override
+	{
+		if constexpr (std::is_arithmetic<T>::value)
+		{
+			enc.u32(nx);
+			enc.u32(ny);
+			for (unsigned int i = 0; i < nx * ny; i++)
+				enc.value(this->a[i]);
+		}
+		else
+		{
+			GAGenome::encodeGenes(enc);
+		}
+	}
+	bool decodeGenes(GADecoder &dec) override
+	{
+		if constexpr (std::is_arithmetic<T>::value)
+		{
+			std::uint32_t w, h;
+			if (!dec.u32(w) || !dec.u32(h) ||
+				(minX != maxX && (w < minX || w > maxX)) ||
+				(minY != maxY && (h < minY || h > maxY)) ||
+				dec.left() / sizeof(T) < static_cast<std::uint64_t>(w) * h)
+				return dec.fail();
+			GA2DArrayGenome<T>::resize(w, h);
+			for (unsigned int i = 0; i < nx * ny; i++)
+			{
+				T v{};
+				dec.value(v);
+				this->a[i] = v;
+			}
+			_evaluated = false;
+			return dec.ok();
+		}
+		else
+		{
+			return GAGenome::decodeGenes(dec);
+		}
+	}
+
 	bool equal(const GAGenome &c) const override
 	{
 		if (this == &c)
@@ -636,6 +676,10 @@ template <class T> class GA2DArrayGenome : public GAArray<T>, public GAGenome
 			val = GAArray<T>::equal(b, j * nx, j * nx, nx) ? false : true;
 		return (val ? false : true);
 	}
+	bool identical(const GAGenome &c) const override
+	{
+		return c.classID() == classID() && equal(c);
+	}
 
 	const T &gene(unsigned int x, unsigned int y) const
 	{
@@ -767,18 +811,14 @@ template <class T> class GA2DArrayAlleleGenome : public GA2DArrayGenome<T>
 
 		float nMut = pmut * STA_CAST(float, child.size());
 		if (nMut < 1.0)
-		{ // we have to do a flip test on each bit
+		{ // skip to each element that a flip test would pick
 			nMut = 0;
-			for (int i = child.width() - 1; i >= 0; i--)
+			for (int m = child.size() - 1 - GARandomSkip(pmut); m >= 0;
+				 m -= GARandomSkip(pmut) + 1)
 			{
-				for (int j = child.height() - 1; j >= 0; j--)
-				{
-					if (GAFlipCoin(pmut))
-					{
-						child.gene(i, j, child.alleleset().allele());
-						nMut++;
-					}
-				}
+				child.gene(m % child.width(), m / child.width(),
+						   child.alleleset().allele());
+				nMut++;
 			}
 		}
 		else
@@ -68,8 +68,15 @@ class GA2DBinaryStringGenome : public GABinaryString, public GAGenome
 
 	int read(std::istream &) override;
 	int write(std::ostream &) const override;
+	void encodeGenes(GAEncoder &) const override;
+	bool decodeGenes(GADecoder &) override;
 
 	bool equal(const GAGenome &c) const override;
+	bool identical(const GAGenome &c) const override
+	{
+		return c.classID() == classID() && equal(c);
+	}
+	std::uint64_t hash() const override;
 
 	// specific to this class
 	short gene(unsigned int x, unsigned int y) const { return bit(x + nx * y); }
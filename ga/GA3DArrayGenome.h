@@ -59,8 +59,14 @@ template <class T> class GA3DArrayGenome : public GAArray<T>, public GAGenome
 
 	int read(std::istream &) override;
 	int write(std::ostream &) const override;
+	void encodeGenes(GAEncoder &) const override;
+	bool decodeGenes(GADecoder &) override;
 
 	bool equal(const GAGenome &c) const override;
+	bool identical(const GAGenome &c) const override
+	{
+		return c.classID() == classID() && equal(c);
+	}
 
 	const T &gene(unsigned int x, unsigned int y, unsigned int z) const
 	{
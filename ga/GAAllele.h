@@ -372,6 +372,23 @@ template <class T> class GAAlleleSet
 		}
 	}
 
+	// Pick n alleles, as allele() would, into v (the last one first).  The
+	// type of the set is looked at once for all of them, so this is how to fill
+	// many genes from the same set.  The real genome specializes it.
+	void alleles(T *v, unsigned int n) const
+	{
+		if (core->type == GAAllele::Type::ENUMERATED)
+		{
+			for (unsigned int i = n; i-- > 0;)
+				v[i] = core->a[GARandomInt(0, core->sz - 1)];
+		}
+		else
+		{
+			for (unsigned int i = n; i-- > 0;)
+				v[i] = allele();
+		}
+	}
+
 	T lower() const { return core->a[0]; } // only for bounded sets
 	T upper() const { return core->a[1]; }
 	T inc() const { return core->a[2]; }
@@ -0,0 +1,126 @@
+/* ----------------------------------------------------------------------------
+  GAAsyncGA.h
+
+  Steady-state genetic algorithm that keeps evaluations running on the
+  thread pool while it breeds.
+---------------------------------------------------------------------------- */
+
+#pragma once
+
+#include "GASStateGA.h"
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <utility>
+
+/** Asynchronous steady-state genetic algorithm.
+ *
+ * The steady-state GA breeds a batch of children, waits for all of them to
+ * be evaluated, then puts them into the population.  While the slowest
+ * evaluation of a batch runs the other threads have nothing to do.
+ *
+ * This GA keeps nInFlight() children being evaluated on the thread pool at
+ * all times.  As soon as the score of any child arrives the child is added to
+ * the population and the worst genome (by scaled score) is removed, then a
+ * new child is bred from the updated population and sent off to take its
+ * place.  Only the main thread selects, breeds and touches the population;
+ * the pool threads only run the objective function.
+ *
+ * One step inserts nReplacement() children, after which the statistics are
+ * updated as they are for the steady-state GA.  Children are still in flight
+ * between steps, and the next step inserts them as they arrive.  evolve()
+ * waits for them before it returns; if you drive the GA with step() call
+ * finish() before you destroy anything the objective function uses.
+ *
+ * Children are inserted in the order their evaluations finish, so with more
+ * than one thread a run is not repeatable even with a fixed seed.  With one
+ * thread (or one evaluation in flight) the children are evaluated in turn on
+ * the calling thread and the run is repeatable.
+ *
+ * evalsPerSecond() reports the throughput: the number of children evaluated
+ * per second of time spent in step().
+ *
+ * write() waits for the children in flight, and those that have arrived but
+ * are not yet in the population go into the checkpoint with it.
+ */
+class GAAsyncSteadyStateGA : public GASteadyStateGA
+{
+  public:
+	GADefineIdentity("GAAsyncSteadyStateGA", GAID::AsyncSteadyStateGA);
+
+	static GAParameterList &registerDefaultParameters(GAParameterList &);
+
+  public:
+	explicit GAAsyncSteadyStateGA(const GAGenome &);
+	explicit GAAsyncSteadyStateGA(const GAPopulation &);
+	GAAsyncSteadyStateGA(const GAAsyncSteadyStateGA &);
+	GAAsyncSteadyStateGA &operator=(const GAAsyncSteadyStateGA &);
+	~GAAsyncSteadyStateGA() override;
+	void copy(const GAGeneticAlgorithm &) override;
+
+	void initialize(unsigned int seed = 0) override;
+	void step() override;
+	void evolve(unsigned int seed = 0) override;
+	GAAsyncSteadyStateGA &operator++()
+	{
+		step();
+		return *this;
+	}
+
+	int setptr(const std::string &name, const void *value) override;
+	int get(const char *name, void *value) const override;
+
+	const GAPopulation &population() const override { return *pop; }
+	const GAPopulation &population(const GAPopulation &) override;
+
+	/// Number of evaluations kept running (0 means one per thread).
+	int nInFlight() const { return nflight; }
+	int nInFlight(unsigned int n)
+	{
+		params.set(gaNnInFlight, static_cast<int>(n));
+		return nflight = n;
+	}
+
+	/// Wait for the evaluations that are still running.
+	void finish();
+
+	unsigned long int evaluations() const { return ndone; }
+	double evalsPerSecond() const;
+
+  protected:
+	unsigned int flightSize() const;
+	GAGenome *breed();
+	void launch();
+	std::pair<GAGenome *, bool> arrival();
+	void insert(GAGenome *child, bool evaluated);
+	void discard();
+	void encodeState(GAEncoder &enc) const override;
+	bool decodeState(GADecoder &dec) override;
+
+	unsigned int nflight; // how many evaluations to keep running
+
+	// The pool threads only touch these, and only while holding amtx.
+	std::mutex amtx;
+	std::condition_variable acv;
+	// children waiting to be inserted, and whether each one was evaluated
+	// (rather than inheriting a parent's score)
+	std::deque<std::pair<GAGenome *, bool>> arrived;
+	unsigned int running = 0; // evaluations on the pool right now
+	std::exception_ptr error; // first exception thrown by an objective
+
+	unsigned long int ndone = 0; // children evaluated since initialize
+	std::chrono::steady_clock::duration busy{}; // time spent in step
+};
+
+inline std::ostream &operator<<(std::ostream &os, GAAsyncSteadyStateGA &arg)
+{
+	arg.write(os);
+	return (os);
+}
+inline std::istream &operator>>(std::istream &is, GAAsyncSteadyStateGA &arg)
+{
+	arg.read(is);
+	return (is);
+}
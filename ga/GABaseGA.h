@@ -56,10 +56,20 @@ constexpr auto gaNpMigration = "migration_percentage";
 constexpr auto gaSNpMigration = "pmig";
 constexpr auto gaNnMigration = "migration_number";
 constexpr auto gaSNnMigration = "nmig";
+constexpr auto gaNmigrationTopology = "migration_topology";
+constexpr auto gaSNmigrationTopology = "mtopo";
+constexpr auto gaNmigrationInterval = "migration_interval";
+constexpr auto gaSNmigrationInterval = "mint";
 constexpr auto gaNminimaxi = "minimaxi";
 constexpr auto gaSNminimaxi = "mm";
 constexpr auto gaNseed = "seed";
 constexpr auto gaSNseed = "seed";
+constexpr auto gaNnThreads = "number_of_threads";
+constexpr auto gaSNnThreads = "nthreads";
+constexpr auto gaNparallelBreeding = "parallel_breeding";
+constexpr auto gaSNparallelBreeding = "pbreed";
+constexpr auto gaNnInFlight = "evaluations_in_flight";
+constexpr auto gaSNnInFlight = "nflight";
 
 extern int gaDefNumGen;
 extern float gaDefPConv;
@@ -73,11 +83,16 @@ extern int gaDefNRepl;
 extern int gaDefNumOff;
 extern float gaDefPMig;
 extern int gaDefNMig;
+extern int gaDefMigrationTopology;
+extern int gaDefMigrationInterval;
 extern int gaDefSelectScores;
 extern int gaDefMiniMaxi;
 extern bool gaDefDivFlag;
 extern bool gaDefElitism;
 extern int gaDefSeed;
+extern int gaDefNThreads;
+extern bool gaDefParallelBreeding;
+extern int gaDefNInFlight;
 
 
 /**
@@ -149,10 +164,33 @@ class GAGeneticAlgorithm : public GAID
 			stats.flushScores();
 		}
 	}
-	virtual int write(const char *) const { return 0; }
-	virtual int write(std::ostream &) const { return 0; }
-	virtual int read(const char *) { return 0; }
-	virtual int read(std::istream &) { return 0; }
+
+	/**
+	 * Write a checkpoint of the GA to a file: the parameters, the statistics
+	 * (with the best-of-all population), the population(s) and the state of
+	 * the random number generator, in the GAlib binary encoding.  The file is
+	 * written beside the old one and then renamed over it, so a crash while
+	 * writing leaves the last checkpoint as it was.  Returns 0 on success.
+	 */
+	virtual int write(const char *filename) const;
+	virtual int write(std::ostream &) const;
+
+	/**
+	 * Carry on from a checkpoint.  The GA must have been made the same way as
+	 * the one that wrote it (the same class, a genome of the same class, the
+	 * same objective, scaling and selection) but not initialized; after a
+	 * read, call step() or done() as if the run had never stopped.  A resumed
+	 * run makes the same generations as one that was not stopped.  The global
+	 * random number generator is put back as it was, so read the checkpoint
+	 * after anything else that draws random numbers.  Returns 0 on success.
+	 */
+	virtual int read(const char *filename);
+	virtual int read(std::istream &);
+
+	/// Append a checkpoint to a buffer (this is what write() puts in a file).
+	void encode(GAEncoder &enc) const;
+	/// Restore the GA from a checkpoint made by encode().
+	bool decode(GADecoder &dec);
 
 	void *userData() const { return ud; }
 	void *userData(void *d) { return ud = d; }
@@ -272,6 +310,14 @@ class GAGeneticAlgorithm : public GAID
 		return stats.nBestGenomes(pop->individual(0), n);
 	}
 
+	/**
+	 * Number of threads used to evaluate the population.  With more than one
+	 * thread the GA switches its populations from the default evaluator to
+	 * the parallel evaluator (custom population evaluators are left alone).
+	 */
+	virtual int nThreads() const { return nthreads; }
+	virtual int nThreads(unsigned int n);
+
 	virtual GAScalingScheme &scaling() const { return pop->scaling(); }
 	virtual GAScalingScheme &scaling(const GAScalingScheme &s)
 	{
@@ -297,6 +343,7 @@ class GAGeneticAlgorithm : public GAID
     void *ud; 
 
 	int d_seed;
+	unsigned int nthreads;
 	unsigned int ngen;
 	unsigned int nconv;
 	float pconv;
@@ -309,4 +356,16 @@ class GAGeneticAlgorithm : public GAID
 
     /// asexual crossover to use
 	GAGenome::AsexualCrossover across; 
+
+	void useThreads(GAPopulation &p) const;
+
+	/**
+	 * The part of a checkpoint that is not parameters or random numbers.  The
+	 * base class writes the statistics and the population; GAs that keep
+	 * more between generations add it after that.  By the time decodeState()
+	 * is called the parameters have been set, so the populations are already
+	 * the size they will be.
+	 */
+	virtual void encodeState(GAEncoder &enc) const;
+	virtual bool decodeState(GADecoder &dec);
 };
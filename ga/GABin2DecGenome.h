@@ -20,8 +20,6 @@ out, please turn off the lights).
   binary to integer phenotype?
 
  TO DO:
-*** Eventually we may want to cache the values in the phenotype mapping, but
-	for now we'll generate them on the fly.
 *** Need to write a read method that can interpret binary/decimal input.
 ---------------------------------------------------------------------------- */
 #ifndef _ga_bin2dec_h_
@@ -30,6 +28,7 @@ out, please turn off the lights).
 #include <GA1DBinStrGenome.h>
 #include <gabincvt.h>
 #include <cstdint>
+#include <vector>
 
 
 #ifdef max
@@ -136,7 +135,7 @@ class GABin2DecGenome : public GA1DBinaryStringGenome
 		decoder(DEFAULT_BIN2DEC_DECODER);
 	}
 	GABin2DecGenome(const GABin2DecGenome &orig)
-		: GA1DBinaryStringGenome(orig.data.size())
+		: GA1DBinaryStringGenome(orig.GABinaryString::size())
 	{
 		ptype = nullptr;
 		copy(orig);
@@ -162,6 +161,17 @@ class GABin2DecGenome : public GA1DBinaryStringGenome
 	float phenotype(unsigned int n, float val);
 	float phenotype(unsigned int n) const;
 
+	/** The values of all of the phenotypes, decoded in one pass.
+	 *
+	 * The values are kept until the bits change (by mutation, crossover,
+	 * copy or setting a phenotype), so an objective function can call this
+	 * on every evaluation.  Since the cache is filled on first use, do not
+	 * call this on the same genome from several threads at once.
+	 */
+	const std::vector<float> &values() const;
+	/// Put the values of all of the phenotypes into out.
+	void values(double *out) const;
+
 	void encoder(GABinaryEncoder e)
 	{
 		encode = e;
@@ -170,13 +180,22 @@ class GABin2DecGenome : public GA1DBinaryStringGenome
 	void decoder(GABinaryDecoder d)
 	{
 		decode = d;
+		cached = false;
 		_evaluated = false;
 	}
 
   protected:
+	bool fastDecode(unsigned int n) const;
+
 	GABin2DecPhenotype *ptype;
 	GABinaryEncoder encode; // function we use to encode the bits
 	GABinaryDecoder decode; // function we use to decode the bits
+
+	mutable bool cached = false; // are vals up to date with version cver?
+	mutable std::uint64_t cver = 0;
+	mutable std::vector<float> vals; // decoded phenotypes
+	mutable std::vector<std::uint64_t> raw; // their integer values
+	mutable std::vector<std::uint64_t> len; // and lengths
 };
 
 #endif
@@ -0,0 +1,223 @@
+/* ----------------------------------------------------------------------------
+  GACodec.h
+
+  A compact binary encoding for genomes and populations, for checkpoints and
+  for sending them to other processes.
+---------------------------------------------------------------------------- */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+
+/// Version of the encoding that GAlib writes.  Records of any other version
+/// are refused when they are decoded.
+constexpr std::uint8_t GA_CODEC_VERSION = 1;
+
+/** Append values to a buffer in the GAlib binary encoding.
+ *
+ * Integers are written least significant byte first, float and double as
+ * their IEEE bit patterns and bool as one byte, so that the encoding is the
+ * same on every platform we build on.  Strings (and other runs of bytes) are
+ * written with a four-byte length before them.
+ *
+ *	 std::string buf;
+ *	 GAEncoder enc(buf);
+ *	 pop.encode(enc);
+ */
+class GAEncoder
+{
+  public:
+	explicit GAEncoder(std::string &b) : buf(b) {}
+
+	std::string &buffer() const { return buf; }
+
+	void u8(std::uint8_t v) { buf.push_back(static_cast<char>(v)); }
+	void u32(std::uint32_t v) { put(v, 4); }
+	void u64(std::uint64_t v) { put(v, 8); }
+
+	/// Write a number of any arithmetic type.
+	template <class T> void value(T v)
+	{
+		static_assert(std::is_arithmetic<T>::value,
+					  "only numbers can be encoded");
+		if constexpr (std::is_same<T, bool>::value)
+		{
+			u8(v ? 1 : 0);
+		}
+		else if constexpr (std::is_floating_point<T>::value)
+		{
+			static_assert(sizeof(T) == 4 || sizeof(T) == 8,
+						  "float and double only");
+			if constexpr (sizeof(T) == 4)
+			{
+				std::uint32_t w;
+				std::memcpy(&w, &v, 4);
+				u32(w);
+			}
+			else
+			{
+				std::uint64_t w;
+				std::memcpy(&w, &v, 8);
+				u64(w);
+			}
+		}
+		else
+		{
+			put(static_cast<std::uint64_t>(v), sizeof(T));
+		}
+	}
+
+	/// Write n bytes as they are, without a length.
+	void bytes(const void *p, std::size_t n)
+	{
+		buf.append(static_cast<const char *>(p), n);
+	}
+	/// Write a string with its length.
+	void text(const std::string &s)
+	{
+		u32(static_cast<std::uint32_t>(s.size()));
+		buf.append(s);
+	}
+
+	/// Keep room for a four-byte length to be filled in by end(); returns
+	/// where it is.
+	std::size_t begin()
+	{
+		std::size_t at = buf.size();
+		u32(0);
+		return at;
+	}
+	/// Fill in the length of everything written since begin().
+	void end(std::size_t at)
+	{
+		auto n = static_cast<std::uint32_t>(buf.size() - at - 4);
+		for (unsigned int i = 0; i < 4; i++)
+		{
+			buf[at + i] = static_cast<char>((n >> (8 * i)) & 0xff);
+		}
+	}
+
+  protected:
+	void put(std::uint64_t v, unsigned int n)
+	{
+		for (unsigned int i = 0; i < n; i++)
+		{
+			buf.push_back(static_cast<char>((v >> (8 * i)) & 0xff));
+		}
+	}
+
+	std::string &buf;
+};
+
+/** Read values written by a GAEncoder.
+ *
+ * Each getter returns false (and leaves its argument alone) if the buffer
+ * runs out; after that every getter fails, so a decode can check ok() once
+ * at the end rather than after each value.
+ */
+class GADecoder
+{
+  public:
+	GADecoder(const char *p, std::size_t n) : cur(p), last(p + n) {}
+	explicit GADecoder(const std::string &b)
+		: cur(b.data()), last(b.data() + b.size())
+	{
+	}
+
+	bool ok() const { return good; }
+	/// Bytes not yet read.
+	std::size_t left() const { return static_cast<std::size_t>(last - cur); }
+	/// Give up on the rest of the buffer (when what is in it makes no sense).
+	bool fail() { return good = false; }
+
+	bool u8(std::uint8_t &v)
+	{
+		std::uint64_t w;
+		return get(w, 1) && (v = static_cast<std::uint8_t>(w), true);
+	}
+	bool u32(std::uint32_t &v)
+	{
+		std::uint64_t w;
+		return get(w, 4) && (v = static_cast<std::uint32_t>(w), true);
+	}
+	bool u64(std::uint64_t &v) { return get(v, 8); }
+
+	template <class T> bool value(T &v)
+	{
+		static_assert(std::is_arithmetic<T>::value,
+					  "only numbers can be decoded");
+		if constexpr (std::is_same<T, bool>::value)
+		{
+			std::uint8_t w;
+			return u8(w) && (v = (w != 0), true);
+		}
+		else if constexpr (std::is_floating_point<T>::value)
+		{
+			static_assert(sizeof(T) == 4 || sizeof(T) == 8,
+						  "float and double only");
+			if constexpr (sizeof(T) == 4)
+			{
+				std::uint32_t w;
+				return u32(w) && (std::memcpy(&v, &w, 4), true);
+			}
+			else
+			{
+				std::uint64_t w;
+				return u64(w) && (std::memcpy(&v, &w, 8), true);
+			}
+		}
+		else
+		{
+			std::uint64_t w;
+			return get(w, sizeof(T)) && (v = static_cast<T>(w), true);
+		}
+	}
+
+	/// Point p at the next n bytes and skip them.
+	bool bytes(const char *&p, std::size_t n)
+	{
+		if (!good || left() < n)
+		{
+			return fail();
+		}
+		p = cur;
+		cur += n;
+		return true;
+	}
+	bool text(std::string &s)
+	{
+		std::uint32_t n;
+		const char *p;
+		if (!u32(n) || !bytes(p, n))
+		{
+			return false;
+		}
+		s.assign(p, n);
+		return true;
+	}
+
+  protected:
+	bool get(std::uint64_t &v, unsigned int n)
+	{
+		if (!good || left() < n)
+		{
+			return fail();
+		}
+		v = 0;
+		for (unsigned int i = 0; i < n; i++)
+		{
+			v |= static_cast<std::uint64_t>(static_cast<unsigned char>(cur[i]))
+				 << (8 * i);
+		}
+		cur += n;
+		return true;
+	}
+
+	const char *cur;
+	const char *last;
+	bool good = true;
+};
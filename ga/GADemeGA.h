@@ -15,11 +15,22 @@ topology in this implementation).
 redefine the migration method.  If you want to use a different kind of genetic
 algorithm for each population then you'll have to modify the mechanics of the
 step method.
+  The populations are independent between migrations, so each step evolves
+them on up to nThreads() threads at once.  Each population breeds with its own
+random stream, split off a seed drawn from the global generator, so for the
+same seed the result is the same however many threads are used.
+  Migration happens every migrationInterval() generations.  The topology says
+where the migrants go: RING sends them to the next population (the original
+stepping-stone model), FULL to every other population, and RANDOM to one
+other population picked at random each time.  In all of them the migrants are
+copies of the best individuals, and they replace the worst individuals of the
+population they arrive in.
 ---------------------------------------------------------------------------- */
 #ifndef _ga_gademe_h_
 #define _ga_gademe_h_
 
 #include <GABaseGA.h>
+#include <vector>
 
 class GADemeGA : public GAGeneticAlgorithm
 {
@@ -30,6 +41,12 @@ class GADemeGA : public GAGeneticAlgorithm
 	{
 		ALL = (-1)
 	};
+	enum MigrationTopology
+	{
+		RING = 0,
+		FULL,
+		RANDOM
+	};
 	static GAParameterList &registerDefaultParameters(GAParameterList &);
 
   public:
@@ -67,6 +84,16 @@ class GADemeGA : public GAGeneticAlgorithm
 		GAGeneticAlgorithm::populationSize(n);
 		return populationSize(ALL, n);
 	}
+	int nThreads() const override { return nthreads; }
+	int nThreads(unsigned int n) override
+	{
+		GAGeneticAlgorithm::nThreads(n);
+		for (unsigned int ii = 0; ii < npop; ii++)
+		{
+			useThreads(*deme[ii]);
+		}
+		return nthreads;
+	}
 	GAScalingScheme &scaling() const override { return pop->scaling(); }
 	GAScalingScheme &scaling(const GAScalingScheme &s) override
 	{
@@ -90,7 +117,10 @@ class GADemeGA : public GAGeneticAlgorithm
 		objectiveData(ALL, v);
 	}
 
-	const GAPopulation &population(unsigned int i) const { return *deme[i]; }
+	virtual const GAPopulation &population(unsigned int i) const
+	{
+		return *deme[i];
+	}
 	const GAPopulation &population(int i, const GAPopulation &);
 	int populationSize(unsigned int i) const { return deme[i]->size(); }
 	int populationSize(int i, unsigned int n);
@@ -98,6 +128,10 @@ class GADemeGA : public GAGeneticAlgorithm
 	int nReplacement(int i, unsigned int n);
 	int nMigration() const { return nmig; }
 	int nMigration(unsigned int i);
+	int migrationTopology() const { return mtopo; }
+	int migrationTopology(int t);
+	int migrationInterval() const { return mint; }
+	int migrationInterval(unsigned int n);
 	int nPopulations() const { return npop; }
 	int nPopulations(unsigned int i);
 
@@ -118,12 +152,26 @@ class GADemeGA : public GAGeneticAlgorithm
 	const GAStatistics &statistics(unsigned int i) const { return pstats[i]; }
 
   protected:
+	void evolveDeme(unsigned int i); // one generation of population i
+	void gather(); // master population and statistics from the populations
+	void tally(); // statistics from the master population and the counts
+	void routeMigrants(); // where each population sends this time
+	bool sends(unsigned int i, unsigned int d) const; // does i send to d?
+	void dropSpares();
+	void encodeState(GAEncoder &enc) const override;
+	bool decodeState(GADecoder &dec) override;
+
 	unsigned int npop; // how many populations do we have?
 	int *nrepl; // how many to replace each generation
 	GAPopulation **deme; // array of populations that we'll use
-	GAPopulation *tmppop; // temp pop for doing the evolutions
+	GAPopulation **tmppop; // temp pops for doing the evolutions (one per deme)
 	GAStatistics *pstats; // statistics for each population
 	unsigned int nmig; // number to migrate from each population
+	int mtopo; // where the migrants go
+	unsigned int mint; // how many generations between migrations
+	std::vector<GAGenome *> moving; // the genomes being migrated
+	std::vector<GAGenome *> spare; // genomes pushed out by migrants
+	std::vector<unsigned int> route; // where each population sends to
 };
 
 inline std::ostream &operator<<(std::ostream &os, GADemeGA &arg)
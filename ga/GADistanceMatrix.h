@@ -0,0 +1,101 @@
+/* ----------------------------------------------------------------------------
+  GADistanceMatrix.h
+
+  Pairwise distances between the individuals of a population.
+---------------------------------------------------------------------------- */
+
+#pragma once
+
+#include <GAGenome.h>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+class GAPopulation;
+
+/** Table of the distances between all pairs of individuals in a population.
+ *
+ * Distances are assumed to be symmetric and zero on the diagonal, so only the
+ * upper triangle is stored.  The table is filled in square tiles of TILE by
+ * TILE pairs so that the genomes being compared stay in cache, and the tiles
+ * are spread across the threads of the GAThreadPool.
+ *
+ * Each genome gets a slot in the table, remembered by its stamp (see
+ * GAGenome::stamp).  When the population changes by only a few genomes, as it
+ * does in each step of a steady-state or incremental GA, update() computes
+ * the rows of the genomes that are new (or have changed) and reuses all of
+ * the others, so a step costs O(k*n) rather than O(n*n) comparisons.  It also
+ * copes with the population having been reordered.
+ *
+ * GAPopulation keeps one of these for its diversity measure and GASharing
+ * reuses it when it compares genomes the same way.
+ */
+class GADistanceMatrix
+{
+  public:
+	static constexpr unsigned int TILE = 64;
+
+	GADistanceMatrix() = default;
+
+	/** Compute the distances between all of the individuals of p.
+	 *
+	 * If df is nullptr, each genome's own compare() is used.  The work is
+	 * split across up to nthreads threads.  The result does not depend on
+	 * the number of threads.
+	 */
+	void compute(const GAPopulation &p, GAGenome::Comparator df = nullptr,
+				 unsigned int nthreads = 1);
+
+	/** Bring the table up to date with the individuals of p.
+	 *
+	 * Only the genomes whose stamps the table has not seen are compared.  If
+	 * more than half of the population is new (or the table was computed with
+	 * a different comparator) this is the same as compute().
+	 */
+	void update(const GAPopulation &p, GAGenome::Comparator df = nullptr,
+				unsigned int nthreads = 1);
+
+	/// Forget the distances.  The next update() computes all of them.
+	void clear();
+
+	/// Number of individuals the table was computed for.
+	unsigned int size() const { return n; }
+
+	/// Distance between individuals i and j (0 if i == j).
+	float operator()(unsigned int i, unsigned int j) const
+	{
+		unsigned int a = pos[i];
+		unsigned int b = pos[j];
+		if (a == b)
+		{
+			return 0.0;
+		}
+		return (a < b ? d[index(a, b)] : d[index(b, a)]);
+	}
+
+	/// Sum of the distances over all pairs i < j.
+	double sum() const { return total; }
+
+  protected:
+	std::size_t index(unsigned int a, unsigned int b) const
+	{
+		return static_cast<std::size_t>(a) * (2 * cap - a - 1) / 2 + (b - a - 1);
+	}
+	float distance(const GAGenome &a, const GAGenome &b) const
+	{
+		return (cmp != nullptr ? (*cmp)(a, b) : a.compare(b));
+	}
+	void release(unsigned int slot);
+
+	bool valid = false;
+	unsigned int n = 0; // number of individuals
+	unsigned int cap = 0; // number of slots
+	double total = 0.0;
+	GAGenome::Comparator cmp = nullptr;
+	std::vector<float> d; // upper triangle over the slots, row by row
+	std::vector<unsigned int> pos; // slot of each individual
+	std::vector<const GAGenome *> who; // genome in each slot (or nullptr)
+	std::vector<std::uint64_t> key; // stamp of the genome in each slot
+	std::unordered_map<std::uint64_t, unsigned int> slots; // stamp to slot
+};
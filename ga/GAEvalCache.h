@@ -0,0 +1,84 @@
+/* ----------------------------------------------------------------------------
+  GAEvalCache.h
+
+  Bounded cache of objective scores keyed by genome contents.
+---------------------------------------------------------------------------- */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+/** Cache of objective scores, keyed by a 64-bit hash of the genome contents.
+ *
+ * Give a cache to a genome with GAGenome::evalCache and every clone of that
+ * genome shares it.  Before a genome calls its objective function it looks up
+ * its hash (see GAGenome::hash) in the cache, and after the call it stores
+ * the score there.  Only genomes that can hash themselves use the cache - the
+ * binary string genomes and the array genomes of built-in types.
+ *
+ * The cache holds at most capacity() scores.  When it is full the CLOCK
+ * algorithm picks the score to throw out: each entry has a bit that is set
+ * when it is used, and a hand sweeps over the entries clearing bits until it
+ * finds one that has not been used since the last sweep.  That is close to
+ * least-recently-used, but a hit only has to set a bit.
+ *
+ * The entries are split over a number of shards, each with its own lock, so
+ * the threads of a parallel evaluator rarely wait for each other.
+ *
+ * The cache assumes that the score depends only on the genes (and the
+ * objective function, which is part of the key).  Do not use it with noisy
+ * objectives or ones that look at evaluation or user data that changes.
+ */
+class GAEvalCache
+{
+  public:
+	static constexpr unsigned int DEFAULT_SHARDS = 16;
+
+	explicit GAEvalCache(unsigned int capacity,
+						 unsigned int nshards = DEFAULT_SHARDS);
+	GAEvalCache(const GAEvalCache &) = delete;
+	GAEvalCache &operator=(const GAEvalCache &) = delete;
+
+	/// If key is in the cache put its score in score and return true.
+	bool find(std::uint64_t key, float &score);
+	/// Remember the score for key (replacing the old one if there is one).
+	void insert(std::uint64_t key, float score);
+	/// Forget all of the scores and zero the counters.
+	void clear();
+
+	unsigned int capacity() const { return cap; }
+	unsigned int size() const;
+	unsigned long int hits() const { return nhit.load(std::memory_order_relaxed); }
+	unsigned long int misses() const
+	{
+		return nmiss.load(std::memory_order_relaxed);
+	}
+
+  protected:
+	struct Shard
+	{
+		mutable std::mutex mtx;
+		std::unordered_map<std::uint64_t, unsigned int> where; // key to slot
+		std::vector<std::uint64_t> key;
+		std::vector<float> score;
+		std::vector<char> used; // the CLOCK bits
+		unsigned int hand = 0;
+		unsigned int limit = 0; // at most this many slots
+	};
+	Shard &shard(std::uint64_t key)
+	{
+		return shards[(key >> 32) % shards.size()];
+	}
+
+	unsigned int cap;
+	std::vector<Shard> shards;
+	std::atomic<unsigned long int> nhit{0};
+	std::atomic<unsigned long int> nmiss{0};
+};
+
+using GAEvalCachePtr = std::shared_ptr<GAEvalCache>;
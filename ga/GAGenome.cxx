@@ -12,6 +12,11 @@ specific details about base class member functions.
 ---------------------------------------------------------------------------- */
 #include <GAGenome.h>
 
+#include <atomic>
+#include <limits>
+#include <sstream>
+#include <string>
+
 //   These are the default genome operators.
 // None does anything - they just post an error message to let you know that no
 // method has been defined.  These are for the base class (which has no
@@ -31,6 +36,14 @@ float GAGenome::NoComparator(const GAGenome &c, const GAGenome &)
 	return -1.0;
 }
 
+// Stamps come from one counter shared by all genomes, so a genome that is
+// deleted and replaced by another at the same address still gets a new one.
+std::uint64_t GAGenome::NewStamp()
+{
+	static std::atomic<std::uint64_t> next(1);
+	return next.fetch_add(1, std::memory_order_relaxed);
+}
+
 GAGenome::GAGenome(Initializer i, Mutator m, Comparator c)
 {
 	if (i == nullptr)
@@ -48,6 +61,7 @@ GAGenome::GAGenome(Initializer i, Mutator m, Comparator c)
 	_score = _fitness = 0.0;
 	_evaluated = false;
 	_neval = 0;
+	_stamp = NewStamp();
 	ga = nullptr;
 	ud = nullptr;
 	eval = nullptr;
@@ -85,9 +99,11 @@ void GAGenome::copy(const GAGenome &orig)
 	_score = orig._score;
 	_fitness = orig._fitness;
 	_evaluated = orig._evaluated;
+	_stamp = NewStamp();
 	ga = orig.ga;
 	ud = orig.ud;
 	eval = orig.eval;
+	cache = orig.cache;
 	init = orig.init;
 	mutr = orig.mutr;
 	cmp = orig.cmp;
@@ -108,6 +124,26 @@ void GAGenome::copy(const GAGenome &orig)
 	} // don't delete if c doesn't have one
 }
 
+/** Take the score of parent, rather than being evaluated, if this genome
+ * needs an evaluation but has the same genes and objective as parent.
+ *
+ * Copying a genome already carries its score along.  This catches the
+ * children that come out of crossover (and mutation) unchanged, as they do
+ * when two identical parents mate.  Returns true if the score was taken.
+ */
+bool GAGenome::inherit(const GAGenome &parent)
+{
+	if (_evaluated || !parent._evaluated || eval != parent.eval ||
+		!identical(parent))
+	{
+		return false;
+	}
+	_score = parent._score;
+	_evaluated = true;
+	_stamp = NewStamp();
+	return true;
+}
+
 float GAGenome::evaluate(bool flag) const
 {
 	if (_evaluated == false || flag == true)
@@ -115,10 +151,132 @@ float GAGenome::evaluate(bool flag) const
 		auto *This = const_cast<GAGenome *>(this);
 		if (eval != nullptr)
 		{
-			This->_neval++;
-			This->_score = (*eval)(*This);
+			std::uint64_t key = cacheKey();
+			if (key == 0 || !cache->find(key, This->_score))
+			{
+				This->_neval++;
+				This->_score = (*eval)(*This);
+				if (key != 0)
+				{
+					cache->insert(key, _score);
+				}
+			}
 		}
 		This->_evaluated = true;
+		This->_stamp = NewStamp();
 	}
 	return _score;
 }
+
+// The genes and the objective make the key, so the same genes under another
+// objective are a different entry.
+std::uint64_t GAGenome::cacheKey() const
+{
+	std::uint64_t key = (cache != nullptr && eval != nullptr ? hash() : 0);
+	if (key != 0)
+	{
+		key = HashCombine(key, reinterpret_cast<std::uintptr_t>(eval));
+	}
+	return key;
+}
+
+bool GAGenome::lookup()
+{
+	std::uint64_t key = cacheKey();
+	if (key == 0 || !cache->find(key, _score))
+	{
+		return false;
+	}
+	_evaluated = true;
+	_stamp = NewStamp();
+	return true;
+}
+
+float GAGenome::record(float s)
+{
+	std::uint64_t key = cacheKey();
+	_neval++;
+	_score = s;
+	_evaluated = true;
+	_stamp = NewStamp();
+	if (key != 0)
+	{
+		cache->insert(key, s);
+	}
+	return s;
+}
+
+// A record is the class of the genome, the version of the encoding, whether
+// it has been evaluated, its score, and then the genes with their length in
+// front of them so that a genome that reads less than was written (or a
+// reader that does not care about the genes) can skip to the next record.
+void GAGenome::encode(GAEncoder &enc) const
+{
+	enc.u32(static_cast<std::uint32_t>(classID()));
+	enc.u8(GA_CODEC_VERSION);
+	enc.u8(_evaluated ? 1 : 0);
+	enc.value(_score);
+	std::size_t at = enc.begin();
+	encodeGenes(enc);
+	enc.end(at);
+}
+
+bool GAGenome::decode(GADecoder &dec)
+{
+	std::uint32_t id, n;
+	std::uint8_t version, flags;
+	float s;
+	const char *p;
+	if (!dec.u32(id) || !dec.u8(version) || !dec.u8(flags) || !dec.value(s) ||
+		!dec.u32(n) || !dec.bytes(p, n))
+	{
+		GAErr(GA_LOC, className(), "decode", "the record is cut short");
+		return false;
+	}
+	if (id != static_cast<std::uint32_t>(classID()))
+	{
+		GAErr(GA_LOC, className(), "decode",
+			  "the record is for another class of genome");
+		return dec.fail();
+	}
+	if (version != GA_CODEC_VERSION)
+	{
+		GAErr(GA_LOC, className(), "decode",
+			  "the record is of version " + std::to_string(version) +
+				  " of the encoding");
+		return dec.fail();
+	}
+	GADecoder genes(p, n);
+	if (!decodeGenes(genes) || !genes.ok())
+	{
+		GAErr(GA_LOC, className(), "decode",
+			  "the genes do not fit this genome");
+		return dec.fail();
+	}
+	_evaluated = (flags & 1) != 0;
+	if (_evaluated)
+	{
+		_score = s;
+	}
+	_stamp = NewStamp();
+	return true;
+}
+
+void GAGenome::encodeGenes(GAEncoder &enc) const
+{
+	std::ostringstream os;
+	os.precision(std::numeric_limits<double>::max_digits10);
+	write(os);
+	enc.text(os.str());
+}
+
+bool GAGenome::decodeGenes(GADecoder &dec)
+{
+	std::string s;
+	if (!dec.text(s))
+	{
+		return false;
+	}
+	std::istringstream is(s);
+	return read(is) == 0;
+}
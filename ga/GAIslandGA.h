@@ -0,0 +1,130 @@
+/* ----------------------------------------------------------------------------
+  GAIslandGA.h
+
+  Header for the island genetic algorithm, a deme GA whose populations evolve
+  in separate processes.
+---------------------------------------------------------------------------- */
+
+#pragma once
+
+#include "GADemeGA.h"
+#include <string>
+#include <vector>
+
+/** Deme genetic algorithm with each population on an island of its own.
+ *
+ * An island is a process that evolves one population and talks to this GA
+ * (the master) over a socket.  spawn() forks one island per population on
+ * this host.  For islands on other hosts, the master calls listen() and
+ * accept(), and each remote process builds a GA set up like the master's and
+ * calls join() with the master's address.
+ *
+ * Each island evolves the first population of its own GA object, so configure
+ * the GA (genome, objective, operators, sizes) before you spawn.  Islands run
+ * their generations at the same time.  After every generation the master asks
+ * them for their statistics and their best individuals, which is all that the
+ * overall statistics need, and keeps the statistics in statistics(i).  The
+ * populations stay on the islands until population(i) reads one, the run
+ * ends or a checkpoint is written, and only then come over.
+ *
+ * Migration is that of the deme GA, with its topology and interval: copies of
+ * the best nMigration() of each island go where the topology sends them, they
+ * replace the worst individuals there, and those leave the GA.
+ *
+ * Genomes cross the wire in the GAlib binary encoding, scores and all (see
+ * GAGenome::encode).  Genome types of your own go as the text of their
+ * write() unless they define encodeGenes() and decodeGenes().  A genome that
+ * has been sent keeps its score and is not evaluated again.  Each island
+ * breeds with a seed drawn from the master's generator, so for the same seed
+ * a run gives the same result.
+ *
+ * An island that has not answered within timeout() milliseconds is taken for
+ * lost.  The master then brings over what populations it still can, stops
+ * the islands and carries on without them.
+ *
+ * Without islands (before spawn or accept, or after reap) this GA is the
+ * deme GA and evolves its populations on threads.
+ *
+ * A checkpoint (see write()) holds the master's copies of the populations and
+ * statistics but not the state of the islands, which keep generators of their
+ * own, so carry on from one without islands, as a deme GA.
+ *
+ * Islands are POSIX processes; on Windows spawn, listen and join fail.
+ */
+class GAIslandGA : public GADemeGA
+{
+  public:
+	GADefineIdentity("GAIslandGA", GAID::IslandGA);
+
+  public:
+	explicit GAIslandGA(const GAGenome &);
+	explicit GAIslandGA(const GAPopulation &);
+	GAIslandGA(const GAIslandGA &);
+	GAIslandGA &operator=(const GAIslandGA &);
+	~GAIslandGA() override;
+	void copy(const GAGeneticAlgorithm &) override;
+
+	void initialize(unsigned int seed = 0) override;
+	void evolve(unsigned int seed = 0) override;
+	void step() override;
+	void migrate() override;
+	GAIslandGA &operator++()
+	{
+		step();
+		return *this;
+	}
+
+	/// Fork one island per population on this host.  Returns how many run.
+	int spawn();
+	/// Listen for remote islands on a TCP port (0 picks one).  Returns the
+	/// port, or -1 on failure.
+	int listen(unsigned short port);
+	/// Wait for n remote islands to join.  Returns how many did.
+	int accept(unsigned int n);
+	/// Be an island of the master at host:port until it is done with us.
+	int join(const std::string &host, unsigned short port);
+	/// Bring the populations over, stop the islands and wait for the local
+	/// ones to exit.
+	void reap();
+
+	int nIslands() const { return static_cast<int>(islands.size()); }
+	/// How long to wait for an island to answer, in milliseconds (a negative
+	/// number waits for as long as it takes).
+	int timeout() const { return wait; }
+	int timeout(int ms) { return wait = ms; }
+
+	using GADemeGA::population;
+	const GAPopulation &population(unsigned int i) const override;
+
+  protected:
+	struct Island
+	{
+		int fd; // socket to the island
+		int pid; // process id of a local island, 0 for a remote one
+	};
+
+	int serve(int fd);
+	bool command(char tag, const std::string &body, unsigned int i);
+	bool reply(unsigned int i, char tag, std::string &body);
+	bool collect(bool update);
+	bool fetch(int which);
+	void quit();
+	void lost(const char *func);
+	void encodeState(GAEncoder &enc) const override;
+
+	std::vector<Island> islands;
+	std::vector<bool> stale; // has the island moved on from our population?
+	int lfd = -1; // listening socket for remote islands
+	int wait = 60000; // how long to wait for an answer, in milliseconds
+};
+
+inline std::ostream &operator<<(std::ostream &os, GAIslandGA &arg)
+{
+	arg.write(os);
+	return (os);
+}
+inline std::istream &operator>>(std::istream &is, GAIslandGA &arg)
+{
+	arg.read(is);
+	return (is);
+}
@@ -55,6 +55,27 @@ template <class T> GANode<T> *_GAListCopy(GANode<T> *node, GANode<T> *head)
 	return newnode;
 }
 
+// Destroy a node and all of the nodes in the list after it.  Pooled nodes go
+// back to their pool all at once.
+template <class T> void _GAListDestroy(GANode<T> *node)
+{
+	if (!node)
+		return;
+	if (GANodePool<T>::enabled)
+	{
+		GANodePool<T>::release(node);
+		return;
+	}
+	GANodeBASE *tmp = node->next;
+	while (tmp && tmp != node)
+	{
+		GANodeBASE *next = tmp->next;
+		delete tmp;
+		tmp = next;
+	}
+	delete node;
+}
+
 /** Container for nodes that have a list structure
  *
  * The base list object is responsible for maintaining the list heirarchy.
@@ -72,9 +93,8 @@ template <class T> GANode<T> *_GAListCopy(GANode<T> *node, GANode<T> *head)
  * a part of a list that no longer exists (I would need some kind of reference
  * counting and/or message passing to take care of this at a lower level, and I'm
  * not ready to implement that at this point).
- * For now we allocate nodes on the fly.  Eventually I would like to do some
- * better memory management (arrays perhaps?) so we don't have to do so much
- * alloc and dealloc and recursion.
+ * The nodes come from a GANodePool, so making and deleting them seldom goes
+ * to the heap.
  * We depend on the template-ized GAListIter routine, thus the declaration.
  * 
  * current, head, tail, next, prev, warp
@@ -89,11 +109,7 @@ template <class T> class GAList : public GAListBASE
   public:
 	GAList() : GAListBASE() { iter(*this); }
 	explicit GAList(const T &t) : GAListBASE(new GANode<T>(t)), iter(*this) {}
-	GAList(const GAList<T> &orig)
-	{
-		iter(*this);
-		copy(orig);
-	}
+	GAList(const GAList<T> &orig) : GAListBASE(), iter(*this) { copy(orig); }
 	GAList<T> &operator=(const GAList<T> &orig)
 	{
 		if (&orig != this)
@@ -104,8 +120,8 @@ template <class T> class GAList : public GAListBASE
 	// The destructor just goes through the list and deletes every node.
 	virtual ~GAList()
 	{
-		while (hd)
-			delete GAListBASE::remove(DYN_CAST(GANode<T> *, hd));
+		_GAListDestroy(DYN_CAST(GANode<T> *, hd));
+		hd = nullptr;
 		iter.node = nullptr;
 	}
 
@@ -152,8 +168,7 @@ template <class T> class GAList : public GAListBASE
 	 */
 	void copy(const GAList<T> &orig)
 	{
-		while (hd)
-			delete GAListBASE::remove(DYN_CAST(GANode<T> *, hd));
+		_GAListDestroy(DYN_CAST(GANode<T> *, hd));
 		hd = _GAListCopy(DYN_CAST(GANode<T> *, orig.hd),
 						 DYN_CAST(GANode<T> *, orig.hd));
 		iter.node = hd;
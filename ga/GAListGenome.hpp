@@ -613,6 +613,52 @@ template <class T> class GAListGenome : public GAList<T>, public GAGenome
 		return 0;
 	}
 
+	// Lists of built-in types are encoded as the number of nodes and then
+	// their contents from the head on.  Others fall back to write() and read().
+	void encodeGenes(GAEncoder &enc) const override
+	{
+		if constexpr (std::is_arithmetic<T>::value)
+		{
+			enc.u32(static_cast<std::uint32_t>(this->size()));
+			GANodeBASE *tmp = this->hd;
+			do
+			{
+				if (!tmp)
+					break;
+				enc.value(DYN_CAST(GANode<T> *, tmp)->contents);
+				tmp = tmp->next;
+			} while (tmp != this->hd);
+		}
+		else
+		{
+			GAGenome::encodeGenes(enc);
+		}
+	}
+	bool decodeGenes(GADecoder &dec) override
+	{
+		if constexpr (std::is_arithmetic<T>::value)
+		{
+			std::uint32_t n;
+			if (!dec.u32(n) || dec.left() / sizeof(T) < n)
+				return dec.fail();
+			while (this->head())
+				destroy();
+			for (std::uint32_t i = 0; i < n; i++)
+			{
+				T v{};
+				dec.value(v);
+				insert(v, GAListBASE::AFTER);
+			}
+			this->head();
+			_evaluated = false;
+			return dec.ok();
+		}
+		else
+		{
+			return GAGenome::decodeGenes(dec);
+		}
+	}
+
 	// Both the == and != operators assume that both operator== and operator!=
 	// are
 	// defined for the object that is store in the node of your list.  If it is
@@ -7,7 +7,11 @@
 
 #include <gaconfig.h>
 
+#include <atomic>
+#include <cstddef>
+#include <new>
 #include <ostream>
+#include <type_traits>
 
 
 /** This is the basic node object
@@ -75,6 +79,8 @@ of the node get destroyed as well.
  * 
  * @tparam T 
  */
+template <class T> class GANodePool;
+
 template <class T> struct GANode : public GANodeBASE
 {
 	T contents;
@@ -86,6 +92,161 @@ template <class T> struct GANode : public GANodeBASE
 		contents = t;
 		return contents;
 	}
+
+	// Nodes come from the pool for their type (see GANodePool).  Anything
+	// derived from a node is a different size and goes to the heap.
+	static void *operator new(std::size_t n)
+	{
+		if (GANodePool<T>::enabled && n == sizeof(GANode<T>))
+			return GANodePool<T>::allocate();
+		return ::operator new(n);
+	}
+	static void operator delete(void *p, std::size_t n)
+	{
+		if (GANodePool<T>::enabled && n == sizeof(GANode<T>))
+			GANodePool<T>::deallocate(p);
+		else
+			::operator delete(p);
+	}
+};
+
+/** Whether the nodes of lists and trees of T come from a GANodePool.  They do
+ * unless you say otherwise for your type:
+ *
+ *	 template <> struct GANodePooled<MyType> : std::false_type {};
+ */
+template <class T> struct GANodePooled : std::true_type
+{
+};
+
+/** Free list of the nodes for lists and trees of T.
+ *
+ * List and tree genomes make and delete nodes all the time - every clone and
+ * every crossover copies trees, and every generation deletes the ones that
+ * did not make it.  Rather than go to the heap for each node we keep the
+ * nodes that were deleted and hand them out again, and get new ones from the
+ * heap a chunk at a time.
+ *
+ * A whole list or tree can be given back with release().  If the contents
+ * of the nodes need no destructor this takes no time at all: the nodes stay
+ * linked as they were, and are taken off the tree one at a time as they are
+ * handed out again.  Otherwise each node is destroyed as it would have been.
+ *
+ * Each thread has a pool of its own, so nodes do not need locks.  Nodes may
+ * be deleted by a thread other than the one that made them; they go to the
+ * pool of the thread that deleted them.  The chunks are never given back to
+ * the heap, so the pool stays as big as the most nodes there have ever been
+ * at one time.
+ */
+template <class T> class GANodePool
+{
+  public:
+	static constexpr bool enabled =
+		GANodePooled<T>::value &&
+		alignof(GANode<T>) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+	static constexpr std::size_t CHUNK = 256; // nodes we get from the heap at once
+
+	static void *allocate()
+	{
+		Pool &p = pool;
+		if (p.free)
+		{
+			Free *f = p.free;
+			p.free = f->next;
+			return f;
+		}
+		if (p.dead)
+		{
+			return exhume(p);
+		}
+		if (p.cur == p.end)
+		{
+			grow(p);
+		}
+		void *n = p.cur;
+		p.cur += sizeof(GANode<T>);
+		return n;
+	}
+
+	static void deallocate(void *n)
+	{
+		Pool &p = pool;
+		Free *f = ::new (n) Free;
+		f->next = p.free;
+		p.free = f;
+	}
+
+	/// Give back a node, its siblings, and all of their children.
+	static void release(GANode<T> *node)
+	{
+		if (!node)
+			return;
+		Pool &p = pool;
+		bury(p, node);
+		if (!std::is_trivially_destructible<T>::value)
+		{
+			while (p.dead)
+				delete exhume(p);
+		}
+	}
+
+  protected:
+	struct Free
+	{
+		Free *next;
+	};
+	struct Pool
+	{
+		Free *free = nullptr; // nodes that were deleted
+		GANodeBASE *dead = nullptr; // trees that were released, linked by prev
+		char *cur = nullptr; // what is left of the last chunk
+		char *end = nullptr;
+	};
+
+	// Put a ring of siblings on the dead list.  The ring is cut after its last
+	// node so that the nodes can be followed by next from the first.
+	static void bury(Pool &p, GANodeBASE *n)
+	{
+		if (!n)
+			return;
+		if (n->prev)
+			n->prev->next = nullptr;
+		n->prev = p.dead;
+		p.dead = n;
+	}
+
+	// Take the first node off the dead list, and put its children and the rest
+	// of its siblings there instead.
+	static GANode<T> *exhume(Pool &p)
+	{
+		GANodeBASE *n = p.dead;
+		p.dead = n->prev;
+		bury(p, n->child);
+		if (n->next)
+		{
+			n->next->prev = p.dead;
+			p.dead = n->next;
+		}
+		return static_cast<GANode<T> *>(n);
+	}
+
+	// The first node of each chunk links it to the one before, so that the
+	// chunks can always be reached.
+	static void grow(Pool &p)
+	{
+		auto *c = static_cast<char *>(
+			::operator new(CHUNK * sizeof(GANode<T>)));
+		void *last = chunks.load();
+		do
+		{
+			*static_cast<void **>(static_cast<void *>(c)) = last;
+		} while (!chunks.compare_exchange_weak(last, c));
+		p.cur = c + sizeof(GANode<T>);
+		p.end = c + CHUNK * sizeof(GANode<T>);
+	}
+
+	inline static thread_local Pool pool;
+	inline static std::atomic<void *> chunks{nullptr};
 };
 
 template <class T> std::ostream &operator<<(std::ostream &os, GANode<T> &arg)
@@ -12,6 +12,7 @@ track of the fitness statistics for the genomes in the population.
 #ifndef _ga_population_h_
 #define _ga_population_h_
 
+#include <GADistanceMatrix.h>
 #include <GAEvalData.h>
 #include <GAGenome.h>
 #include <GAScaling.h>
@@ -19,6 +20,8 @@ track of the fitness statistics for the genomes in the population.
 #include <gaconfig.h>
 #include <gaid.h>
 
+#include <cmath>
+
 #ifdef max
 #undef max
 #endif
@@ -42,6 +45,11 @@ sort
 does not change the logical state of the population, but it does change its
 physical state.  We sort from best (0th individual) to worst (n-1).  The sort
 figures out whether high is best or low is best.
+  The best and worst members (and remove/replace of BEST or WORST) do not sort
+the whole population.  They use a partial sort to put just the individuals
+they need at the front or back, so asking for the best few after a replace
+costs O(n log k) rather than O(n log n).  The rest of the order is sorted
+only when someone asks for it with sort().
 
 evaluate
   If you want to force an evaluation, pass true to the evaluate member
@@ -56,6 +64,17 @@ statistics
   Update the statistics.  We do this only on-demand so that no unneeded
 calculations take place.
 
+evaluator
+  The default evaluator calls the evaluate member of each genome in turn.  The
+parallel evaluator hands the genomes that have not yet been evaluated to a
+pool of threads.  Use nThreads to specify how many threads it may use.  Each
+genome is still evaluated exactly once, so the scores (and the evaluation
+counts kept by each genome) do not depend on the number of threads, but your
+objective function must be safe to call concurrently on different genomes.
+  The process evaluator sends the genomes to the worker processes of the
+current GAProcessPool instead, for objective functions that are not safe to
+call from more than one thread.
+
 diversity
   Like the statistics function, we call this one only on demand.  This member
 function can be particularly expensive, especially for large populations.  So
@@ -72,6 +91,8 @@ class GAPopulation : public GAID
 
 	static void DefaultInitializer(GAPopulation &);
 	static void DefaultEvaluator(GAPopulation &);
+	static void ParallelEvaluator(GAPopulation &);
+	static void ProcessEvaluator(GAPopulation &);
 
   public:
 	enum SortBasis
@@ -114,12 +135,16 @@ class GAPopulation : public GAID
 	{
 		rsorted = ssorted = selectready = divved = statted = scaled =
 			evaluated = false;
+		rrank.reset();
+		srank.reset();
+		indDiv.clear();
 	}
 	void statistics(bool flag = false) const;
 	void diversity(bool flag = false) const;
 	void scale(bool flag = false) const;
 	void prepselect(bool flag = false) const;
 	void sort(bool flag = false, SortBasis basis = RAW) const;
+	void rank(SortBasis basis, unsigned int ntop, unsigned int nbot) const;
 
 	float sum() const
 	{
@@ -183,7 +208,16 @@ class GAPopulation : public GAID
 		{
 			diversity();
 		}
-		return indDiv[i * n + j];
+		return indDiv(i, j);
+	}
+	/// The table behind div(i,j), computed if it is not up to date.
+	const GADistanceMatrix &distances() const
+	{
+		if (!divved)
+		{
+			diversity();
+		}
+		return indDiv;
 	}
 	float fitsum() const
 	{
@@ -242,6 +276,8 @@ class GAPopulation : public GAID
 			(*eval)(*this);
 			neval++;
 			scaled = statted = divved = rsorted = ssorted = false;
+			rrank.reset();
+			srank.reset();
 		}
 		evaluated = true;
 	}
@@ -259,6 +295,8 @@ class GAPopulation : public GAID
 	}
 	Initializer initializer() const { return init; }
 	Initializer initializer(Initializer i) { return init = i; }
+	unsigned int nThreads() const { return nthreads; }
+	unsigned int nThreads(unsigned int nt) { return nthreads = (nt < 1 ? 1 : nt); }
 	SortOrder order() const { return sortorder; }
 	SortOrder order(SortOrder flag);
 	GAGenome &select()
@@ -269,6 +307,14 @@ class GAPopulation : public GAID
 		}
 		return slct->select();
 	}
+	void selectBatch(unsigned int count, GAGenome **out)
+	{
+		if (!selectready)
+		{
+			prepselect();
+		}
+		slct->selectBatch(count, out);
+	}
 	GASelectionScheme &selector() const { return *slct; }
 	GASelectionScheme &selector(const GASelectionScheme &);
 	GAScalingScheme &scaling() const
@@ -297,7 +343,7 @@ class GAPopulation : public GAID
 		{
 			scale();
 		}
-		sort(false, basis);
+		rank(basis, i + 1, 0);
 		return ((basis == RAW) ? *(rind[i]) : *(sind[i]));
 	}
 	GAGenome &worst(unsigned int i = 0, SortBasis basis = RAW) const
@@ -306,7 +352,7 @@ class GAPopulation : public GAID
 		{
 			scale();
 		}
-		sort(false, basis);
+		rank(basis, 0, i + 1);
 		return ((basis == RAW) ? *(rind[n - 1 - i]) : *(sind[n - 1 - i]));
 	}
 	GAGenome &individual(unsigned int i, SortBasis basis = RAW) const
@@ -320,18 +366,92 @@ class GAPopulation : public GAID
 	GAGenome *remove(GAGenome *);
 	GAGenome *replace(GAGenome *, int which = RANDOM, SortBasis basis = RAW);
 	GAGenome *replace(GAGenome *newgenome, GAGenome *oldgenome);
+	GAGenome *exchange(GAGenome *, int which = WORST);
+	GAGenome *exchange(GAGenome *newgenome, GAGenome *oldgenome);
 	void destroy(int w = WORST, SortBasis b = RAW) { delete remove(w, b); }
 
 	virtual void read(std::istream &) {}
 	virtual void write(std::ostream &os, SortBasis basis = RAW) const;
 
+	/** Append the individuals (in the order of the basis) to the buffer in
+	 * the GAlib binary encoding, one genome record after another.
+	 */
+	void encode(GAEncoder &enc, SortBasis basis = RAW) const;
+	/** Replace the individuals with the ones in a record written by encode().
+	 *
+	 * The population grows (with copies of its first individual) or shrinks
+	 * to the size of the record before the genomes are decoded into it, so
+	 * it must have at least one individual of the class that was encoded.
+	 * The scores of the genomes come with them; the statistics and sorting
+	 * are worked out again when next they are needed.  Returns false if the
+	 * record is not one of a population of this kind of genome.
+	 */
+	bool decode(GADecoder &dec);
+
+	/** Append everything a checkpoint needs to carry on with the population
+	 * exactly where it left off: the individuals, their fitness, the scaled
+	 * order, how far they are sorted and the statistics worked out so far.
+	 * Distances for the diversity and the state of the selector are worked
+	 * out again after a decodeState().
+	 */
+	void encodeState(GAEncoder &enc) const;
+	/// Restore a population from a record written by encodeState().
+	bool decodeState(GADecoder &dec);
+
   protected:
+	// How much of an unsorted array of individuals is in its final place:
+	// the best 'top' at the front and the worst 'bot' at the back.  'last' is
+	// how many we ranked the last time, so that the next time we rank more.
+	struct Ranking
+	{
+		unsigned int top = 0, bot = 0, last = 0;
+		void reset() { top = bot = last = 0; }
+		// individual i of n was taken out of the array
+		void removed(unsigned int i, unsigned int n)
+		{
+			if (i < top)
+			{
+				top--;
+			}
+			else if (i >= n - bot)
+			{
+				bot--;
+			}
+		}
+	};
+
+	// Is a better than b?  A score that is not a number is worse than any
+	// that is, whichever way the order goes, and no better than another NaN,
+	// so that the sorts get a proper ordering.
+	struct Better
+	{
+		Better(SortBasis b, SortOrder o) : basis(b), order(o) {}
+		bool operator()(GAGenome *a, GAGenome *b) const
+		{
+			float x = (basis == RAW ? a->score() : a->fitness());
+			float y = (basis == RAW ? b->score() : b->fitness());
+			if (std::isnan(x))
+			{
+				return false;
+			}
+			if (std::isnan(y))
+			{
+				return true;
+			}
+			return (order == HIGH_IS_BEST ? x > y : x < y);
+		}
+		SortBasis basis;
+		SortOrder order;
+	};
+
 	unsigned int neval; // number of evals since initialization
 	unsigned int csz; // how big are chunks we allocate?
 	unsigned int n, N; // how many are in the population, allocated
+	unsigned int nthreads; // how many threads the evaluator may use
 	SortOrder sortorder; // is best a high score or a low score?
 	bool rsorted; // are the individuals sorted? (raw)
 	bool ssorted; // are the individuals sorted? (scaled)
+	Ranking rrank, srank; // partially sorted? (raw, scaled)
 	bool scaled; // has the population been scaled?
 	bool statted; // are the stats valid?
 	bool evaluated; // has the population been evaluated?
@@ -341,7 +461,7 @@ class GAPopulation : public GAID
 	float rawMax, rawMin; // max, min of the population's objectives
 	float rawVar, rawDev; // variance, standard deviation
 	float popDiv; // overall population diversity [0,)
-	float *indDiv; // table for genome similarities (diversity)
+	GADistanceMatrix indDiv; // table for genome similarities (diversity)
 	GAGenome **rind; // the individuals of the population (raw)
 	GAGenome **sind; // the individuals of the population (scaled)
 	float fitSum, fitAve; // sum, ave of the population's fitness scores
@@ -356,11 +476,6 @@ class GAPopulation : public GAID
 	GAEvalData *evaldata; // data for evaluator to use (optional)
 
 	int grow(unsigned int);
-
-	static void QuickSortAscendingRaw(GAGenome **, int, int);
-	static void QuickSortDescendingRaw(GAGenome **, int, int);
-	static void QuickSortAscendingScaled(GAGenome **, int, int);
-	static void QuickSortDescendingScaled(GAGenome **, int, int);
 };
 
 inline std::ostream &operator<<(std::ostream &os, const GAPopulation &arg)
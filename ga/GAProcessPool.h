@@ -0,0 +1,97 @@
+/* ----------------------------------------------------------------------------
+  GAProcessPool.h
+
+  A pool of worker processes that evaluate genomes, for objective functions
+  that cannot be called from more than one thread at a time.
+---------------------------------------------------------------------------- */
+
+#pragma once
+
+#include <GAGenome.h>
+#include <GAPopulation.h>
+
+#include <atomic>
+#include <deque>
+#include <mutex>
+#include <vector>
+
+/** Pool of worker processes that evaluate genomes.
+ *
+ * Each worker is a fork of this process with its own copy of everything the
+ * objective function uses, so objectives that keep global state (wrappers of
+ * old simulation codes, for example) can run in several workers at once.
+ * Workers are started when the pool is made and stop when it is destroyed.
+ *
+ * The genomes go to the workers over Unix sockets in the GAlib binary
+ * encoding, in batches of batchSize(), and each worker decodes them into a
+ * copy of the genome the pool was made with and evaluates them with its
+ * objective.  Every worker has up to two batches queued so that it never
+ * waits for the master between them.  The scores come back in the same
+ * order.  Genome types of your own are sent as the text of their write()
+ * unless they define encodeGenes() and decodeGenes().
+ *
+ * A worker that dies is replaced, and the genomes it had are evaluated again
+ * one at a time.  A genome that has taken down a worker three times is not
+ * tried again: an error is reported and it gets the worst score of the
+ * genomes evaluated with it.
+ *
+ * To evaluate populations with the pool, give them the process evaluator:
+ *
+ *	 GAProcessPool workers(genome, 4);
+ *	 GAPopulation pop(genome, 50);
+ *	 pop.evaluator(GAPopulation::ProcessEvaluator);
+ *
+ * The process evaluator uses the pool made last that still exists.  Genomes
+ * that the evaluation cache knows are not sent.  Calls from several threads
+ * take turns.
+ *
+ * Workers are POSIX processes; on Windows the pool has none and evaluates
+ * the genomes itself.
+ */
+class GAProcessPool
+{
+  public:
+	/// The pool that the process evaluator uses, if there is one.
+	static GAProcessPool *current() { return active.load(); }
+
+  public:
+	/// Start nworkers workers (0 means one per hardware thread).
+	GAProcessPool(const GAGenome &prototype, unsigned int nworkers = 0,
+				  unsigned int batch = 4);
+	GAProcessPool(const GAProcessPool &) = delete;
+	GAProcessPool &operator=(const GAProcessPool &) = delete;
+	~GAProcessPool();
+
+	unsigned int size() const { return static_cast<unsigned int>(workers.size()); }
+	unsigned int batchSize() const { return nbatch; }
+	/// How many workers have been replaced since the pool was made.
+	unsigned long int restarts() const { return nrestart; }
+
+	/// Evaluate the n genomes and give each its score.  The order says which
+	/// score is the worst.
+	void evaluate(GAGenome *const *g, unsigned int n,
+				  GAPopulation::SortOrder order = GAPopulation::HIGH_IS_BEST);
+	/// Evaluate the genomes of the population that need it.
+	void evaluate(GAPopulation &p);
+
+  protected:
+	struct Worker
+	{
+		int fd; // socket to the worker
+		int pid; // its process id
+		std::deque<std::vector<unsigned int>> queued; // batches sent to it
+	};
+
+	bool start(Worker &w);
+	void stop(Worker &w);
+	bool restart(Worker &w);
+	int serve(int fd) const;
+
+	static std::atomic<GAProcessPool *> active;
+
+	GAGenome *proto; // what the workers read genomes into
+	unsigned int nbatch; // genomes per message
+	std::vector<Worker> workers;
+	unsigned long int nrestart = 0;
+	std::mutex mtx; // one evaluation at a time
+};
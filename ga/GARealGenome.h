@@ -9,64 +9,112 @@
 #include <GAAllele.h>
 #include <GA1DArrayGenome.hpp>
 
+// The real genome is an array allele genome of floats or of doubles.  The
+// operators below take the scalar type as a template argument that defaults
+// to float, so GARealGaussianMutator is the float mutator and
+// GARealGaussianMutator<double> the double one.  Only float and double are
+// instantiated.
 using GARealAlleleSet = GAAlleleSet<float>;
 using GARealAlleleSetArray = GAAlleleSetArray<float>;
 
 using GARealGenome = GA1DArrayAlleleGenome<float>;
 
-int GARealGaussianMutator(GAGenome &, float);
+using GADoubleAlleleSet = GAAlleleSet<double>;
+using GADoubleAlleleSetArray = GAAlleleSetArray<double>;
 
-// in one (and only one) place in the code that uses the string genome, you 
-// should define INSTANTIATE_STRING_GENOME in order to force the specialization
-// for this genome.
-#if defined(INSTANTIATE_REAL_GENOME)
-#include <GARealGenome.C>
-#endif
+using GADoubleGenome = GA1DArrayAlleleGenome<double>;
+
+// The members that the real genomes do their own way.  They are declared here
+// so that code using the genomes gets them rather than the generic ones.
+template <> float GAAlleleSet<float>::allele() const;
+template <> float GAAlleleSet<float>::allele(unsigned int) const;
+template <> void GAAlleleSet<float>::alleles(float *, unsigned int) const;
+template <> const char *GA1DArrayAlleleGenome<float>::className() const;
+template <> int GA1DArrayAlleleGenome<float>::classID() const;
+template <>
+GA1DArrayAlleleGenome<float>::GA1DArrayAlleleGenome(unsigned int,
+													const GAAlleleSet<float> &,
+													GAGenome::Evaluator, void *);
+template <>
+GA1DArrayAlleleGenome<float>::GA1DArrayAlleleGenome(
+	const GAAlleleSetArray<float> &, GAGenome::Evaluator, void *);
+template <> int GA1DArrayAlleleGenome<float>::read(std::istream &);
+
+template <> double GAAlleleSet<double>::allele() const;
+template <> double GAAlleleSet<double>::allele(unsigned int) const;
+template <> void GAAlleleSet<double>::alleles(double *, unsigned int) const;
+template <> const char *GA1DArrayAlleleGenome<double>::className() const;
+template <> int GA1DArrayAlleleGenome<double>::classID() const;
+template <>
+GA1DArrayAlleleGenome<double>::GA1DArrayAlleleGenome(
+	unsigned int, const GAAlleleSet<double> &, GAGenome::Evaluator, void *);
+template <>
+GA1DArrayAlleleGenome<double>::GA1DArrayAlleleGenome(
+	const GAAlleleSetArray<double> &, GAGenome::Evaluator, void *);
+template <> int GA1DArrayAlleleGenome<double>::read(std::istream &);
 
-inline void GARealUniformInitializer(GAGenome& g){
-  GA1DArrayAlleleGenome<float>::UniformInitializer(g);
+template <class T = float> int GARealGaussianMutator(GAGenome &, float);
+
+template <class T = float> inline void GARealUniformInitializer(GAGenome& g){
+  GA1DArrayAlleleGenome<T>::UniformInitializer(g);
 }
-inline void GARealOrderedInitializer(GAGenome& g){
-  GA1DArrayAlleleGenome<float>::OrderedInitializer(g);
+template <class T = float> inline void GARealOrderedInitializer(GAGenome& g){
+  GA1DArrayAlleleGenome<T>::OrderedInitializer(g);
 }
 
-inline int GARealUniformMutator(GAGenome& g, float pmut){
-  return GA1DArrayAlleleGenome<float>::FlipMutator(g, pmut);
+template <class T = float> inline int GARealUniformMutator(GAGenome& g, float pmut){
+  return GA1DArrayAlleleGenome<T>::FlipMutator(g, pmut);
 }
-inline int GARealSwapMutator(GAGenome& g, float pmut){
-  return GA1DArrayGenome<float>::SwapMutator(g, pmut);
+template <class T = float> inline int GARealSwapMutator(GAGenome& g, float pmut){
+  return GA1DArrayGenome<T>::SwapMutator(g, pmut);
 }
 
 
+template <class T = float>
 inline int GARealUniformCrossover(const GAGenome& a, const GAGenome& b,
 				  GAGenome* c, GAGenome* d) {
-  return GA1DArrayGenome<float>::UniformCrossover(a,b,c,d);
+  return GA1DArrayGenome<T>::UniformCrossover(a,b,c,d);
 }
+template <class T = float>
 inline int GARealEvenOddCrossover(const GAGenome& a, const GAGenome& b,
 				  GAGenome* c, GAGenome* d) {
-  return GA1DArrayGenome<float>::EvenOddCrossover(a,b,c,d);
+  return GA1DArrayGenome<T>::EvenOddCrossover(a,b,c,d);
 }
+template <class T = float>
 inline int GARealOnePointCrossover(const GAGenome& a, const GAGenome& b,
 				  GAGenome* c, GAGenome* d) {
-  return GA1DArrayGenome<float>::OnePointCrossover(a,b,c,d);
+  return GA1DArrayGenome<T>::OnePointCrossover(a,b,c,d);
 }
+template <class T = float>
 inline int GARealTwoPointCrossover(const GAGenome& a, const GAGenome& b,
 				  GAGenome* c, GAGenome* d) {
-  return GA1DArrayGenome<float>::TwoPointCrossover(a,b,c,d);
+  return GA1DArrayGenome<T>::TwoPointCrossover(a,b,c,d);
 }
+template <class T = float>
 inline int GARealPartialMatchCrossover(const GAGenome& a, const GAGenome& b,
 				  GAGenome* c, GAGenome* d) {
-  return GA1DArrayGenome<float>::PartialMatchCrossover(a,b,c,d);
+  return GA1DArrayGenome<T>::PartialMatchCrossover(a,b,c,d);
 }
+template <class T = float>
 inline int GARealOrderCrossover(const GAGenome& a, const GAGenome& b,
 				  GAGenome* c, GAGenome* d) {
-  return GA1DArrayGenome<float>::OrderCrossover(a,b,c,d);
+  return GA1DArrayGenome<T>::OrderCrossover(a,b,c,d);
 }
+template <class T = float>
 inline int GARealCycleCrossover(const GAGenome& a, const GAGenome& b,
 				  GAGenome* c, GAGenome* d) {
-  return GA1DArrayGenome<float>::CycleCrossover(a,b,c,d);
+  return GA1DArrayGenome<T>::CycleCrossover(a,b,c,d);
 }
+template <class T = float>
 int GARealArithmeticCrossover(const GAGenome& a, const GAGenome& b,
 				  GAGenome* c, GAGenome* d);
+template <class T = float>
 int GARealBlendCrossover(const GAGenome& a, const GAGenome& b,
 				  GAGenome* c, GAGenome* d);
+
+// in one (and only one) place in the code that uses the string genome, you
+// should define INSTANTIATE_STRING_GENOME in order to force the specialization
+// for this genome.
+#if defined(INSTANTIATE_REAL_GENOME)
+#include <GARealGenome.C>
+#endif
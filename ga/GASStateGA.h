@@ -64,6 +64,9 @@ class GASteadyStateGA : public GAGeneticAlgorithm
 	int nReplacement(unsigned int n);
 
   protected:
+	void encodeState(GAEncoder &enc) const override;
+	bool decodeState(GADecoder &dec) override;
+
 	GAPopulation *tmpPop; // temporary population for replacements
 	float pRepl; // percentage of population to replace each gen
 	unsigned int nRepl; // how many of each population to replace
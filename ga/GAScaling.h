@@ -20,6 +20,7 @@ it does know how to update itself, but it must be told when.
 #ifndef _ga_scaling_h_
 #define _ga_scaling_h_
 
+#include <GADistanceMatrix.h>
 #include <GAGenome.h>
 #include <gaconfig.h>
 #include <gaid.h>
@@ -276,7 +277,6 @@ class GASharing : public GAScalingScheme
 	explicit GASharing(GAGenome::Comparator func, float cut = gaDefSharingCutoff,
 			  float a = 1.0)
 	{
-		N = 0;
 		df = func;
 		_sigma = cut;
 		_alpha = a;
@@ -285,14 +285,12 @@ class GASharing : public GAScalingScheme
 	explicit GASharing(float cut = gaDefSharingCutoff, float a = 1.0) :
 		df(nullptr)
 	{
-		N = 0;
 		_sigma = cut;
 		_alpha = a;
 		_minmax = 0;
 	}
 	GASharing(const GASharing &arg) : GAScalingScheme(arg) 
 	{
-		N = 0;
 		copy(arg);
 	}
 	GASharing &operator=(const GAScalingScheme &arg)
@@ -322,8 +320,7 @@ class GASharing : public GAScalingScheme
 
   protected:
 	GAGenome::Comparator df; // the user-defined distance function
-	unsigned int N; // how many do we have? (n of n-by-n)
-	std::vector<float> d; // the distances for each genome pair
+	GADistanceMatrix d; // the distances for each genome pair
 	float _sigma; // absolute cutoff from central point
 	float _alpha; // controls the curvature of sharing f
 	int _minmax; // should we minimize or maximize?
@@ -37,6 +37,7 @@ RouletteWheel - weighted selection where individuals with better fitness have
 #define _ga_selector_h_
 
 #include <gaid.h>
+#include <garandom.h>
 #include <cstring>
 #include <vector>
 
@@ -81,6 +82,19 @@ class GASelectionScheme : public GAID
 	virtual void update() {}
 	virtual GAGenome &select() const = 0;
 
+	/** Select count individuals and put pointers to them in out.
+	 *
+	 * This is the same as calling select() count times, but the selectors
+	 * override it to do their setup once for the whole batch.
+	 */
+	virtual void selectBatch(unsigned int count, GAGenome **out) const
+	{
+		for (unsigned int k = 0; k < count; k++)
+		{
+			out[k] = &select();
+		}
+	}
+
   protected:
 	GAPopulation *pop;
 	int which; // should we use fitness or objective scores?
@@ -118,12 +132,14 @@ class GARankSelector : public GASelectionScheme
 		return new GARankSelector;
 	}
 	GAGenome &select() const override;
+	void selectBatch(unsigned int count, GAGenome **out) const override;
 };
 #endif
 
 /* ----------------------------------------------------------------------------
    Roulette wheel uses a fitness-proportional algorithm for selecting
-individuals.
+individuals.  update() builds an alias table in O(n) time, after which each
+selection takes constant time.  Use selectN to pick many individuals at once.
 ---------------------------------------------------------------------------- */
 #if USE_ROULETTE_SELECTOR == 1 || USE_TOURNAMENT_SELECTOR == 1
 class GARouletteWheelSelector : public GASelectionScheme
@@ -134,13 +150,11 @@ class GARouletteWheelSelector : public GASelectionScheme
 	explicit GARouletteWheelSelector(int w = GASelectionScheme::SCALED)
 		: GASelectionScheme(w)
 	{
-		psum.clear();
 		n = 0;
 	}
 	GARouletteWheelSelector(const GARouletteWheelSelector &orig)
 		: GASelectionScheme(orig)
 	{
-		psum.clear();
 		n = 0;
 		copy(orig);
 	}
@@ -161,14 +175,29 @@ class GARouletteWheelSelector : public GASelectionScheme
 		GASelectionScheme::copy(orig);
 		const GARouletteWheelSelector &sel =
 			DYN_CAST(const GARouletteWheelSelector &, orig);
-		psum = sel.psum;
+		n = sel.n;
+		prob = sel.prob;
+		alias = sel.alias;
 	}
 	GAGenome &select() const override;
+	void selectBatch(unsigned int count, GAGenome **out) const override;
 	void update() override;
 
+	/// Put the indices of count selected individuals into idx.
+	virtual void selectN(unsigned int *idx, unsigned int count) const;
+
   protected:
+	/// Spin the wheel once: O(1) no matter how big the population is.
+	unsigned int pick() const
+	{
+		unsigned int i = GARandomInt(0, n - 1);
+		return (GARandomFloat() < prob[i] ? i : alias[i]);
+	}
+	void table(const std::vector<double> &w);
+
 	int n;
-	std::vector<float> psum;
+	std::vector<float> prob; // chance that slice i picks individual i...
+	std::vector<unsigned int> alias; // ...rather than individual alias[i]
 };
 #endif
 
@@ -205,6 +234,11 @@ class GATournamentSelector : public GARouletteWheelSelector
 		return new GATournamentSelector;
 	}
 	GAGenome &select() const override;
+	void selectBatch(unsigned int count, GAGenome **out) const override;
+	void selectN(unsigned int *idx, unsigned int count) const override;
+
+  protected:
+	unsigned int pick2() const;
 };
 #endif
 
@@ -240,6 +274,7 @@ class GAUniformSelector : public GASelectionScheme
 		return new GAUniformSelector;
 	}
 	GAGenome &select() const override;
+	void selectBatch(unsigned int count, GAGenome **out) const override;
 };
 #endif
 
@@ -283,6 +318,7 @@ class GASRSSelector : public GASelectionScheme
 		choices = sel.choices;
 	}
 	GAGenome &select() const override;
+	void selectBatch(unsigned int count, GAGenome **out) const override;
 	void update() override;
 
   protected:
@@ -333,6 +369,7 @@ class GADSSelector : public GASelectionScheme
 		idx = sel.idx;
 	}
 	GAGenome &select() const override;
+	void selectBatch(unsigned int count, GAGenome **out) const override;
 	void update() override;
 
   protected:
@@ -9,8 +9,12 @@
 #include "GABaseGA.h"
 
 /** Simple genetic algorithm class.
- * 
- * 
+ *
+ * With parallel breeding turned on (and more than one thread) the mating
+ * pairs of each generation are split into contiguous blocks, one per thread,
+ * and each thread breeds its block using its own random stream.  The streams
+ * are split off a seed drawn from the global generator, so for the same seed
+ * and number of threads the result is the same from run to run.
  */
 class GASimpleGA : public GAGeneticAlgorithm
 {
@@ -45,6 +49,13 @@ class GASimpleGA : public GAGeneticAlgorithm
 		return el = flag;
 	}
 
+	bool parallelBreeding() const { return pbreed; }
+	bool parallelBreeding(bool flag)
+	{
+		params.set(gaNparallelBreeding, static_cast<int>(flag));
+		return pbreed = flag;
+	}
+
 	int minimaxi() const override { return minmax; }
 	int minimaxi(int m) override;
 
@@ -52,6 +63,13 @@ class GASimpleGA : public GAGeneticAlgorithm
 	const GAPopulation &population(const GAPopulation &) override;
 	int populationSize() const override { return pop->size(); }
 	int populationSize(unsigned int n) override;
+	int nThreads() const override { return nthreads; }
+	int nThreads(unsigned int n) override
+	{
+		GAGeneticAlgorithm::nThreads(n);
+		useThreads(*oldPop);
+		return nthreads;
+	}
 	GAScalingScheme &scaling() const override { return pop->scaling(); }
 	GAScalingScheme &scaling(const GAScalingScheme &s) override
 	{
@@ -68,8 +86,20 @@ class GASimpleGA : public GAGeneticAlgorithm
 	void objectiveData(const GAEvalData &v) override;
 
   protected:
+	// operator counts for the children bred by one thread
+	struct Tally
+	{
+		unsigned long int numcro = 0;
+		unsigned long int nummut = 0;
+		unsigned long int numeval = 0;
+	};
+	void breed(int i, GAGenome &mom, GAGenome &dad, Tally &t);
+	void encodeState(GAEncoder &enc) const override;
+	bool decodeState(GADecoder &dec) override;
+
 	GAPopulation *oldPop; // current and old populations
 	bool el; // are we elitist?
+	bool pbreed; // breed the mating pairs on several threads?
 };
 
 inline std::ostream &operator<<(std::ostream &os, GASimpleGA &arg)
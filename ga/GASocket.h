@@ -0,0 +1,23 @@
+/* ----------------------------------------------------------------------------
+  GASocket.h
+
+  Messages over stream sockets, for the GAlib objects that talk to other
+  processes (the island GA and the process pool).
+---------------------------------------------------------------------------- */
+
+#pragma once
+
+#include <string>
+
+/** Send a message on a connected stream socket.
+ *
+ * A message is a one-byte tag, a four-byte length (most significant byte
+ * first) and that many bytes of body.  Returns false if the peer has gone; a
+ * dead peer does not raise SIGPIPE where the platform lets us avoid it.
+ */
+bool GASendMessage(int fd, char tag, const std::string &body);
+
+/// Receive a message sent with GASendMessage.  Returns false if the peer has
+/// gone, or if the whole message has not come within timeout milliseconds (a
+/// negative timeout waits for as long as it takes).
+bool GARecvMessage(int fd, char &tag, std::string &body, int timeout = -1);
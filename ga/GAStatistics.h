@@ -65,6 +65,8 @@ class GAStatistics
 	unsigned long int replacements() const { return numrep; }
 	unsigned long int indEvals() const { return numeval; }
 	unsigned long int popEvals() const { return numpeval; }
+	unsigned long int cacheHits() const { return numhit; }
+	unsigned long int cacheMisses() const { return nummiss; }
 	float convergence() const;
 
 	int nConvergence() const { return Nconv; }
@@ -93,6 +95,13 @@ class GAStatistics
 	int write(const std::string &filename) const;
 	int write(std::ostream &os) const;
 
+	/// Append all of the statistics, with the best-of-all population and the
+	/// scores not yet flushed, to a checkpoint.
+	void encode(GAEncoder &enc) const;
+	/// Restore the statistics from a checkpoint.  The genome is the kind
+	/// that the best-of-all population is made of, if we have none yet.
+	bool decode(GADecoder &dec, const GAGenome &genome);
+
 	// These should be protected (accessible only to the GA class) but for now
 	// they are publicly accessible.  Do not try to set these unless you know
 	// what you are doing!!
@@ -102,6 +111,8 @@ class GAStatistics
 	unsigned long int numrep; // number of replacements since reset
 	unsigned long int numeval; // number of individual evaluations since reset
 	unsigned long int numpeval; // number of population evals since reset
+	unsigned long int numhit; // evaluation cache hits (0 if no cache)
+	unsigned long int nummiss; // evaluation cache misses (0 if no cache)
 
   protected:
 	unsigned int curgen; // current generation number
@@ -153,6 +164,7 @@ class GAStatistics
 	void setConvergence(float);
 	void setScore(const GAPopulation &);
 	void updateBestIndividual(const GAPopulation &, bool flag = false);
+	void setCacheCounts(const GAPopulation &);
 	void writeScores();
 	void resizeScores(unsigned int);
 
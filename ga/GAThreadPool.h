@@ -0,0 +1,83 @@
+/* ----------------------------------------------------------------------------
+  GAThreadPool.h
+
+  A small pool of worker threads used by the parallel parts of GAlib
+  (population evaluation, breeding, deme evolution).
+---------------------------------------------------------------------------- */
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/** Pool of worker threads that run fork/join style jobs.
+ *
+ * The pool grows on demand - a job that asks for more workers than the pool
+ * currently holds simply spawns the missing threads, which then stay around
+ * for the next job.  The calling thread always takes part in the job as
+ * worker 0, so a job with one worker never touches the pool at all.
+ *
+ * Jobs that are started from inside a pool thread run serially on that
+ * thread.  This keeps nested parallel sections (a threaded deme that evaluates
+ * its population with a parallel evaluator, for example) from deadlocking.
+ */
+class GAThreadPool
+{
+  public:
+	using Job = std::function<void(unsigned int worker)>;
+	using Body = std::function<void(unsigned int index)>;
+
+	/// The pool shared by all GAlib objects.
+	static GAThreadPool &instance();
+
+	/// Number of hardware threads, or 1 if that cannot be determined.
+	static unsigned int hardwareThreads();
+
+	/// True if the calling thread is one of the pool workers.
+	static bool inWorker();
+
+  public:
+	GAThreadPool() = default;
+	GAThreadPool(const GAThreadPool &) = delete;
+	GAThreadPool &operator=(const GAThreadPool &) = delete;
+	~GAThreadPool();
+
+	unsigned int size() const;
+
+	/** Run job(w) for w in [0,nworkers) and wait until all of them return.
+	 *
+	 * Worker 0 runs on the calling thread.  If any of the workers throws, the
+	 * first exception is rethrown here once all workers have finished.
+	 */
+	void run(unsigned int nworkers, const Job &job);
+
+	/** Call body(i) for every i in [0,n) using up to nworkers threads.
+	 *
+	 * Indices are handed out one at a time so that uneven work (objective
+	 * functions with varying cost) is balanced across the workers.  The order
+	 * in which indices are processed is unspecified.
+	 */
+	void parallelFor(unsigned int n, unsigned int nworkers, const Body &body);
+
+	/** Queue task to run on one of the pool threads and return at once.
+	 *
+	 * The pool is first grown to at least nthreads threads.  Nothing waits for
+	 * the task, so it must not throw and the caller must keep whatever it uses
+	 * alive until it has finished.
+	 */
+	void post(std::function<void()> task, unsigned int nthreads = 1);
+
+  protected:
+	void grow(unsigned int nthreads);
+	void work();
+
+	mutable std::mutex mtx;
+	std::condition_variable cv;
+	std::deque<std::function<void()>> tasks;
+	std::vector<std::thread> threads;
+	bool stopping = false;
+};
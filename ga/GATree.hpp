@@ -136,6 +136,7 @@ template <class T> GANode<T> *_GATreeCopy(GANode<T> *node, GANode<T> *parent)
 // This routine destroys the specified node, its children, its siblings, and
 // all of their children, their childrens' siblings, etc.  Since we kill off
 // all of the siblings, we need to set the parent's link to its child to NULL.
+//   Pooled nodes go back to their pool all at once.
 template <class T> void _GATreeDestroy(GANode<T> *node)
 {
 	if (!node)
@@ -143,6 +144,11 @@ template <class T> void _GATreeDestroy(GANode<T> *node)
 
 	if (node->parent)
 		node->parent->child = nullptr;
+	if (GANodePool<T>::enabled)
+	{
+		GANodePool<T>::release(node);
+		return;
+	}
 	_GATreeDestroy(DYN_CAST(GANode<T> *, node->child));
 
 	GANodeBASE *tmp;
@@ -164,11 +170,7 @@ template <class T> class GATree : public GATreeBASE
   public:
 	GATree() : GATreeBASE() { iter(*this); }
 	explicit GATree(const T &t) : GATreeBASE(new GANode<T>(t)), iter(*this) {}
-	GATree(const GATree<T> &orig)
-	{
-		iter(*this);
-		copy(orig);
-	}
+	GATree(const GATree<T> &orig) : GATreeBASE(), iter(*this) { copy(orig); }
 	GATree<T> &operator=(const GATree<T> &orig)
 	{
 		if (&orig != this)
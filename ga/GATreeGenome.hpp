@@ -317,7 +317,7 @@ template <class T> class GATreeGenome : public GATree<T>, public GAGenome
 	// do a depth-first traversal of the tree and assign coords to the nodes in
 	// the order we get them in the traversal.  Each coord pair is measured
 	// relative to the parent of the node.
-	void _tt(std::ostream &os, GANode<T> *n)
+	static void _tt(std::ostream &os, GANode<T> *n)
 	{
 		if (!n)
 			return;
@@ -363,6 +363,77 @@ template <class T> class GATreeGenome : public GATree<T>, public GAGenome
 		return 0;
 	}
 
+	// Trees of built-in types are encoded as the number of nodes and then the
+	// nodes depth-first, each as its contents and its number of children
+	// (eldest first).  Others fall back to write() and read().
+	void encodeGenes(GAEncoder &enc) const override
+	{
+		if constexpr (std::is_arithmetic<T>::value)
+		{
+			enc.u32(static_cast<std::uint32_t>(this->size()));
+			if (this->rt)
+				_encode(enc, this->rt);
+		}
+		else
+		{
+			GAGenome::encodeGenes(enc);
+		}
+	}
+	bool decodeGenes(GADecoder &dec) override
+	{
+		if constexpr (std::is_arithmetic<T>::value)
+		{
+			std::uint32_t n;
+			if (!dec.u32(n) || dec.left() / (sizeof(T) + 4) < n)
+				return dec.fail();
+			if (this->root())
+				destroy();
+			std::uint32_t left = n;
+			if (n > 0 && !_decode(dec, nullptr, left))
+				return false;
+			this->root();
+			_evaluated = false;
+			return left == 0 || dec.fail();
+		}
+		else
+		{
+			return GAGenome::decodeGenes(dec);
+		}
+	}
+	static void _encode(GAEncoder &enc, GANodeBASE *node)
+	{
+		enc.value(DYN_CAST(GANode<T> *, node)->contents);
+		std::uint32_t k = 0;
+		GANodeBASE *tmp = node->child;
+		do
+		{
+			if (!tmp)
+				break;
+			k++;
+			tmp = tmp->next;
+		} while (tmp != node->child);
+		enc.u32(k);
+		tmp = node->child;
+		for (std::uint32_t i = 0; i < k; i++, tmp = tmp->next)
+			_encode(enc, tmp);
+	}
+	// left is how many of the nodes the record said it has are still to come.
+	bool _decode(GADecoder &dec, GANode<T> *parent, std::uint32_t &left)
+	{
+		T v{};
+		std::uint32_t k;
+		if (left == 0 || !dec.value(v) || !dec.u32(k) || k >= left)
+			return dec.fail();
+		left--;
+		auto *n = new GANode<T>(v);
+		GATree<T>::insert(n, parent,
+						  parent ? GATreeBASE::BELOW : GATreeBASE::ROOT);
+		for (std::uint32_t i = 0; i < k; i++)
+			if (!_decode(dec, n, left))
+				return false;
+		return true;
+	}
+
 	bool equal(const GAGenome &c) const override
 	{
 		if (this == &c)
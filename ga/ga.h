@@ -154,6 +154,8 @@ one copy of the genome type you want to use.
 #include <GAIncGA.h>
 #include <GADemeGA.h>
 #include <GADCrowdingGA.h>
+#include <GAAsyncGA.h>
+#include <GAIslandGA.h>
 
 // Here we include the headers for all of the various genome types.
 #include <GA1DBinStrGenome.h>
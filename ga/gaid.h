@@ -26,6 +26,8 @@ class GAID
 		SteadyStateGA,
 		IncrementalGA,
 		DemeGA,
+		AsyncSteadyStateGA,
+		IslandGA,
 
 		Population = 10,
 
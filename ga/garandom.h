@@ -31,23 +31,164 @@ negative value.  We need speed here, so there's no error checking.
 GARandomBit
   This is a faster implementation of GARandomInt(0,1).
 
+GARandomBits
+  Returns n (at most 64) random bits in the low bits of a word.  With a random
+stream bound to the thread this is a single draw.  Otherwise the bits come
+from the global generator, 24 at a time, so they are as good for seeding other
+generators as the global generator is.  (GARandomBit is a separate, much
+weaker generator, and is not used for this.)
+
 GAFlipCoin
   Simulate a coin toss.  Use specified probability to bias toss.
 
+GARandomSkip
+  The number of tosses of a coin with probability p that come up false before
+one comes up true (a geometric distribution).  Walking through the genes with
+this skips straight from one mutation to the next, so a low mutation rate
+costs one draw per mutation rather than one per gene, and the genes that are
+mutated are distributed the same as with a GAFlipCoin for each of them.  The
+result is at most INT_MAX - 1, so that adding one to it does not overflow.
+
 GAUnitGaussian
   Returns a number from a Gaussian distribution with mean 0 and stddev of 1
 
 GAGaussianFloat, GAGaussianDouble
   Scaled versions of the gaussian distribution.  You must specify a stddev,
 then these functions scale the distribution to that deviation.  Mean is still 0
+
+GASaveRNG, GARestoreRNG
+  Write the state of the global generator (the seed, the generator itself, the
+random bit generator and the cached gaussian) to a checkpoint, and put it back.
+A generator restored this way gives the same numbers from then on as the one
+that was saved.  Random streams are not part of it; they are made from the
+global generator when they are needed.
+
+GARandomStream
+  The functions above share one global generator, so they are neither thread
+safe nor reproducible when several threads draw from them.  A random stream is
+a separate generator (xoshiro256**) with its own state.  Streams are seeded
+from a single master seed and can be split into non-overlapping sub-streams,
+one per thread or per deme.  The jump function advances a stream by 2^128
+draws, so sub-stream i is the master stream jumped i+1 times.
+  Bind a stream to the current thread with GARandomStreamScope and every call
+to the global functions made on that thread (including those inside the
+genome operators) draws from the bound stream instead of the global
+generator.  Threads without a bound stream keep using the global generator.
 ---------------------------------------------------------------------------- */
 #ifndef _ga_random_h_
 #define _ga_random_h_
 
 #include <gaconfig.h>
 #include <gatypes.h>
+#include <cmath>
+#include <cstdint>
 #include <cstdlib>
 
+class GARandomStream
+{
+  public:
+	static constexpr int STATE_SIZE = 4;
+
+	explicit GARandomStream(std::uint64_t seed = 1) { this->seed(seed); }
+
+	void seed(std::uint64_t s);
+	void jump();
+	GARandomStream substream(unsigned int i) const;
+
+	const std::uint64_t *state() const { return s; }
+	void state(const std::uint64_t *st);
+
+	std::uint64_t next()
+	{
+		const std::uint64_t result = rotl(s[1] * 5, 7) * 9;
+		const std::uint64_t t = s[1] << 17;
+		s[2] ^= s[0];
+		s[3] ^= s[1];
+		s[1] ^= s[2];
+		s[0] ^= s[3];
+		s[2] ^= t;
+		s[3] = rotl(s[3], 45);
+		return result;
+	}
+
+	// [0,1) with 24 and 53 bits of resolution, respectively
+	float randomFloat()
+	{
+		return static_cast<float>(next() >> 40) * (1.0f / 16777216.0f);
+	}
+	double randomDouble()
+	{
+		return static_cast<double>(next() >> 11) * (1.0 / 9007199254740992.0);
+	}
+	float randomFloat(float low, float high)
+	{
+		return low + (high - low) * randomFloat();
+	}
+	double randomDouble(double low, double high)
+	{
+		return low + (high - low) * randomDouble();
+	}
+	// inclusive of both low and high
+	int randomInt(int low, int high)
+	{
+		auto range = static_cast<std::uint64_t>(static_cast<std::int64_t>(high) -
+												low + 1);
+		return low + static_cast<int>(((next() >> 32) * range) >> 32);
+	}
+	int randomBit()
+	{
+		if (nbits == 0)
+		{
+			bits = next();
+			nbits = 64;
+		}
+		nbits--;
+		int b = static_cast<int>(bits & 1);
+		bits >>= 1;
+		return b;
+	}
+	bool flipCoin(float p)
+	{
+		return ((p == 1.0) ? true
+						   : (p == 0.0) ? false : ((randomFloat() <= p) ? true : false));
+	}
+	double unitGaussian();
+
+  protected:
+	static std::uint64_t rotl(std::uint64_t x, int k)
+	{
+		return (x << k) | (x >> (64 - k));
+	}
+
+	std::uint64_t s[STATE_SIZE];
+	std::uint64_t bits; // cached bits for randomBit
+	int nbits; // how many of the cached bits are left
+	bool cached; // do we have the twin of the last gaussian?
+	double cachevalue;
+};
+
+// The stream bound to the calling thread, or null if the thread uses the
+// global generator.  Use GARandomStreamScope rather than setting this directly.
+extern thread_local GARandomStream *gaThreadRandomStream;
+
+GARandomStream *GAThreadRandomStream();
+GARandomStream *GAThreadRandomStream(GARandomStream *s);
+
+class GARandomStreamScope
+{
+  public:
+	explicit GARandomStreamScope(GARandomStream &s)
+		: prev(GAThreadRandomStream(&s))
+	{
+	}
+	GARandomStreamScope(const GARandomStreamScope &) = delete;
+	GARandomStreamScope &operator=(const GARandomStreamScope &) = delete;
+	~GARandomStreamScope() { GAThreadRandomStream(prev); }
+
+  protected:
+	GARandomStream *prev;
+};
+
 // Here we determine which random number generator will be used.  The critical
 // parts here are the name of the random number generator (e.g. rand or random)
 // the name of the seed routine (e.g. srand or srandom), the maximum value of
@@ -90,25 +231,58 @@ float garan3();
 
 #endif
 
-inline int GARandomInt() { return _GA_RND() > 0.5 ? 1 : 0; }
+inline int GARandomInt()
+{
+	if (gaThreadRandomStream != nullptr)
+	{
+		return gaThreadRandomStream->randomBit();
+	}
+	return _GA_RND() > 0.5 ? 1 : 0;
+}
 inline int GARandomInt(int low, int high)
 {
+	if (gaThreadRandomStream != nullptr)
+	{
+		return gaThreadRandomStream->randomInt(low, high);
+	}
 	float val = STA_CAST(float, high) - STA_CAST(float, low) + static_cast<float>(1);
 	val *= _GA_RND();
 	return (STA_CAST(int, val) + low);
 }
 
-inline double GARandomDouble() { return _GA_RND(); }
+inline double GARandomDouble()
+{
+	if (gaThreadRandomStream != nullptr)
+	{
+		return gaThreadRandomStream->randomDouble();
+	}
+	return _GA_RND();
+}
 inline double GARandomDouble(double low, double high)
 {
+	if (gaThreadRandomStream != nullptr)
+	{
+		return gaThreadRandomStream->randomDouble(low, high);
+	}
 	double val = high - low;
 	val *= _GA_RND();
 	return val + low;
 }
 
-inline float GARandomFloat() { return _GA_RND(); }
+inline float GARandomFloat()
+{
+	if (gaThreadRandomStream != nullptr)
+	{
+		return gaThreadRandomStream->randomFloat();
+	}
+	return _GA_RND();
+}
 inline float GARandomFloat(float low, float high)
 {
+	if (gaThreadRandomStream != nullptr)
+	{
+		return gaThreadRandomStream->randomFloat(low, high);
+	}
 	float val = high - low;
 	val *= _GA_RND();
 	return val + low;
@@ -144,20 +318,39 @@ inline float GARandomFloat(float low, float high)
 
 #endif
 
-inline int GARandomInt() { return _GA_RND() > _GA_RND_MAX / 2 ? 1 : 0; }
+inline int GARandomInt()
+{
+	if (gaThreadRandomStream != nullptr)
+	{
+		return gaThreadRandomStream->randomBit();
+	}
+	return _GA_RND() > _GA_RND_MAX / 2 ? 1 : 0;
+}
 inline int GARandomInt(int low, int high)
 {
+	if (gaThreadRandomStream != nullptr)
+	{
+		return gaThreadRandomStream->randomInt(low, high);
+	}
 	return low + _GA_RND() % (high - low + 1);
 }
 
 inline double GARandomDouble()
 {
+	if (gaThreadRandomStream != nullptr)
+	{
+		return gaThreadRandomStream->randomDouble();
+	}
 	double val = _GA_RND();
 	val /= _GA_RND_MAX;
 	return val;
 }
 inline double GARandomDouble(double low, double high)
 {
+	if (gaThreadRandomStream != nullptr)
+	{
+		return gaThreadRandomStream->randomDouble(low, high);
+	}
 	double val = high - low;
 	val *= _GA_RND();
 	val /= _GA_RND_MAX;
@@ -167,12 +360,20 @@ inline double GARandomDouble(double low, double high)
 
 inline float GARandomFloat()
 {
+	if (gaThreadRandomStream != nullptr)
+	{
+		return gaThreadRandomStream->randomFloat();
+	}
 	float val = _GA_RND();
 	val /= _GA_RND_MAX;
 	return val;
 }
 inline float GARandomFloat(float low, float high)
 {
+	if (gaThreadRandomStream != nullptr)
+	{
+		return gaThreadRandomStream->randomFloat(low, high);
+	}
 	float val = high - low;
 	val *= _GA_RND();
 	val /= _GA_RND_MAX;
@@ -186,6 +387,8 @@ unsigned int GAGetRandomSeed();
 void GARandomSeed(unsigned int seed = 0);
 void GAResetRNG(unsigned int seed);
 int GARandomBit();
+std::uint64_t GARandomBits(unsigned int n = 64);
+int GARandomSkip(float p);
 double GAUnitGaussian();
 
 inline bool GAFlipCoin(float p)
@@ -203,4 +406,9 @@ inline double GAGaussianDouble(double dev) { return GAUnitGaussian() * dev; }
 
 const char *GAGetRNG();
 
+class GAEncoder;
+class GADecoder;
+void GASaveRNG(GAEncoder &enc);
+bool GARestoreRNG(GADecoder &dec);
+
 #endif
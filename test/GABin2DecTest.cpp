@@ -0,0 +1,82 @@
+#include <boost/test/unit_test.hpp>
+
+#include <GABin2DecGenome.h>
+#include <garandom.h>
+#include <vector>
+
+namespace
+{
+// What the decoder makes of phenotype n, one GABit at a time.
+float reference(const GABin2DecGenome &g, GABinaryDecoder decode, unsigned int n)
+{
+	const GABin2DecPhenotype &p = g.phenotypes();
+	std::vector<GABit> bits(p.length(n));
+	g.unpack(bits.data(), p.offset(n), p.length(n));
+	float val = 0.0;
+	decode(val, bits.data(), p.length(n), p.min(n), p.max(n));
+	return val;
+}
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(UnitTest)
+
+BOOST_AUTO_TEST_CASE(Bin2DecValues_001)
+{
+	// lengths on both sides of the fast limits, some straddling words
+	GABin2DecPhenotype map;
+	unsigned int lengths[] = {1, 7, 13, 24, 25, 30, 3, 16, 20, 9, 28};
+	for (unsigned int l : lengths)
+	{
+		map.add(l, -5.0F, 12.5F);
+	}
+	GABin2DecGenome genome(map);
+
+	GAResetRNG(31);
+	GABinaryDecoder decoders[] = {GABinaryDecode, GAGrayDecode};
+	for (GABinaryDecoder decode : decoders)
+	{
+		genome.decoder(decode);
+		for (int k = 0; k < 50; k++)
+		{
+			genome.initialize();
+			const std::vector<float> &v = genome.values();
+			BOOST_REQUIRE_EQUAL(v.size(), map.nPhenotypes());
+			for (unsigned int n = 0; n < map.nPhenotypes(); n++)
+			{
+				float ref = reference(genome, decode, n);
+				BOOST_CHECK_EQUAL(v[n], ref);
+				BOOST_CHECK_EQUAL(genome.phenotype(n), ref);
+			}
+		}
+	}
+}
+
+BOOST_AUTO_TEST_CASE(Bin2DecValues_002)
+{
+	GABin2DecPhenotype map;
+	map.add(8, 0.0F, 255.0F);
+	map.add(8, 0.0F, 255.0F);
+	GABin2DecGenome genome(map);
+	genome.phenotype(0, 10.0F);
+	genome.phenotype(1, 20.0F);
+
+	// the values are kept until the bits change
+	const std::vector<float> &v = genome.values();
+	BOOST_CHECK_EQUAL(v[0], 10.0F);
+	BOOST_CHECK_EQUAL(v[1], 20.0F);
+	genome.gene(7, 1 - genome.gene(7));
+	BOOST_CHECK_EQUAL(genome.values()[0], 11.0F);
+
+	GABin2DecGenome other(genome);
+	other.phenotype(1, 30.0F);
+	BOOST_CHECK_EQUAL(other.values()[1], 30.0F);
+	genome.copy(other);
+	BOOST_CHECK_EQUAL(genome.values()[1], 30.0F);
+
+	double d[2];
+	genome.values(d);
+	BOOST_CHECK_EQUAL(d[0], 11.0);
+	BOOST_CHECK_EQUAL(d[1], 30.0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -1,7 +1,13 @@
 #include <boost/test/unit_test.hpp>
 
+#include <GA1DBinStrGenome.h>
+#include <GA2DBinStrGenome.h>
+#include <GA3DBinStrGenome.h>
 #include <GABinStr.hpp>
 
+#include <algorithm>
+#include <vector>
+
 
 BOOST_AUTO_TEST_SUITE(UnitTest)
 
@@ -151,4 +157,274 @@ BOOST_AUTO_TEST_CASE(copy_002)
 	BOOST_CHECK_EQUAL(binstr2.bit(3u), 0);
 }
 
+BOOST_AUTO_TEST_CASE(packed_001)
+{
+	// ranges that cross word boundaries, checked against a plain bit vector
+	const unsigned int n = 200;
+	GABinaryString binstr(n);
+	std::vector<int> ref(n);
+	for (unsigned int i = 0; i < n; i++)
+	{
+		ref[i] = ((i * 7) % 3 == 0) ? 1 : 0;
+		binstr.bit(i, ref[i]);
+	}
+
+	binstr.move(70, 5, 120); // overlapping, forward
+	std::copy_backward(ref.begin() + 5, ref.begin() + 125, ref.begin() + 190);
+	for (unsigned int i = 0; i < n; i++)
+	{
+		BOOST_CHECK_EQUAL(binstr.bit(i), ref[i]);
+	}
+
+	binstr.move(3, 60, 130); // overlapping, backward
+	std::copy(ref.begin() + 60, ref.begin() + 190, ref.begin() + 3);
+	for (unsigned int i = 0; i < n; i++)
+	{
+		BOOST_CHECK_EQUAL(binstr.bit(i), ref[i]);
+	}
+
+	binstr.set(10, 100);
+	binstr.unset(150, 40);
+	std::fill(ref.begin() + 10, ref.begin() + 110, 1);
+	std::fill(ref.begin() + 150, ref.begin() + 190, 0);
+	for (unsigned int i = 0; i < n; i++)
+	{
+		BOOST_CHECK_EQUAL(binstr.bit(i), ref[i]);
+	}
+
+	GABinaryString other(n);
+	other.copy(binstr, 0, 0, n);
+	BOOST_CHECK(other.equal(binstr, 0, 0, n));
+	BOOST_CHECK(other.equal(binstr, 13, 13, 170));
+	other.bit(199, 1 - other.bit(199));
+	BOOST_CHECK(!other.equal(binstr, 0, 0, n));
+	BOOST_CHECK(other.equal(binstr, 0, 0, n - 1));
+}
+
+BOOST_AUTO_TEST_CASE(packed_002)
+{
+	GABinaryString binstr(130);
+	binstr.set(0, 130);
+	BOOST_CHECK_EQUAL(binstr.count(), 130);
+
+	// shrinking clears the bits past the end
+	binstr.resize(65);
+	BOOST_CHECK_EQUAL(binstr.count(), 65);
+	binstr.resize(130);
+	BOOST_CHECK_EQUAL(binstr.count(), 65);
+	BOOST_CHECK_EQUAL(binstr.bit(64u), 1);
+	BOOST_CHECK_EQUAL(binstr.bit(65u), 0);
+
+	GARandomStream stream(5);
+	GARandomStreamScope scope(stream);
+	binstr.randomize();
+	BOOST_CHECK(binstr.count() > 30 && binstr.count() < 100);
+}
+
+BOOST_AUTO_TEST_CASE(hamming_001)
+{
+	// long enough to go through the vectorised loop and its scalar tail
+	const unsigned int n = 700;
+	GARandomStream stream(11);
+	GARandomStreamScope scope(stream);
+	GABinaryString a(n), b(n);
+	a.randomize();
+	b.randomize();
+
+	unsigned int ref = 0;
+	for (unsigned int i = 0; i < n; i++)
+	{
+		ref += (a.bit(i) != b.bit(i));
+	}
+	BOOST_CHECK_EQUAL(a.hamming(b), ref);
+	BOOST_CHECK_EQUAL(b.hamming(a), ref);
+	BOOST_CHECK_EQUAL(a.hamming(a), 0);
+
+	b.copy(a);
+	b.bit(3, 1 - b.bit(3));
+	b.bit(699, 1 - b.bit(699));
+	BOOST_CHECK_EQUAL(a.hamming(b), 2);
+}
+
+BOOST_AUTO_TEST_CASE(hamming_002)
+{
+	// the loop picked for this processor counts what the scalar one does, for
+	// short runs of words and for the long ones that go four words at a time
+	GARandomStream stream(13);
+	GARandomStreamScope scope(stream);
+	std::vector<GABinaryString::Word> a(41), b(41);
+	for (std::size_t i = 0; i < a.size(); i++)
+	{
+		a[i] = GARandomBits();
+		b[i] = GARandomBits();
+	}
+	for (std::size_t n = 0; n <= 40; n++)
+	{
+		BOOST_CHECK_EQUAL(GAHammingWords(a.data(), b.data(), n),
+						  GAHammingWordsScalar(a.data(), b.data(), n));
+		// and from a place that is not aligned to four words
+		BOOST_CHECK_EQUAL(GAHammingWords(a.data() + 1, b.data() + 1, n),
+						  GAHammingWordsScalar(a.data() + 1, b.data() + 1, n));
+	}
+
+	// every bit different, so each count is as big as it gets
+	std::vector<GABinaryString::Word> zeros(40, 0), ones(40, ~0ULL);
+	BOOST_CHECK_EQUAL(GAHammingWords(zeros.data(), ones.data(), 40), 40 * 64);
+	BOOST_CHECK_EQUAL(GAHammingWordsScalar(zeros.data(), ones.data(), 40),
+					  40 * 64);
+}
+
+BOOST_AUTO_TEST_CASE(blend_001)
+{
+	// word blends and aligned copies, checked against the bits one at a time
+	const unsigned int n = 333;
+	GARandomStream stream(21);
+	GARandomStreamScope scope(stream);
+	GABinaryString a(n), b(n), c(n);
+	a.randomize();
+	b.randomize();
+
+	std::vector<GABinaryString::Word> mask((n + 63) / 64);
+	for (auto &m : mask)
+	{
+		m = GARandomBits();
+	}
+	std::uint64_t v = c.version();
+	c.blend(a, b, mask.data());
+	BOOST_CHECK(c.version() != v);
+	for (unsigned int i = 0; i < n; i++)
+	{
+		bool first = ((mask[i / 64] >> (i % 64)) & 1) != 0;
+		BOOST_CHECK_EQUAL(c.bit(i), first ? a.bit(i) : b.bit(i));
+	}
+	BOOST_CHECK(c.count() <= n); // nothing past the end
+
+	c.unset(0, n);
+	c.blend(a, b, 37, 200, GABinaryString::EVEN_BITS);
+	for (unsigned int i = 0; i < n; i++)
+	{
+		int want = (i < 37 || i >= 237) ? 0
+										: ((i - 37) % 2 == 0 ? a.bit(i) : b.bit(i));
+		BOOST_CHECK_EQUAL(c.bit(i), want);
+	}
+
+	for (unsigned int off : {0U, 5U, 64U, 70U})
+	{
+		for (unsigned int l : {0U, 3U, 59U, 64U, 130U, 250U})
+		{
+			GABinaryString d(n);
+			d.copy(a, off, off, l);
+			for (unsigned int i = 0; i < n; i++)
+			{
+				BOOST_CHECK_EQUAL(d.bit(i),
+								  (i >= off && i < off + l) ? a.bit(i) : 0);
+			}
+		}
+	}
+}
+
+BOOST_AUTO_TEST_CASE(blend_002)
+{
+	// the blend loop picked for this processor gives what the scalar one does,
+	// with and without words left over after the runs of four
+	GARandomStream stream(17);
+	GARandomStreamScope scope(stream);
+	std::vector<GABinaryString::Word> a(23), b(23), m(23);
+	for (std::size_t i = 0; i < a.size(); i++)
+	{
+		a[i] = GARandomBits();
+		b[i] = GARandomBits();
+		m[i] = GARandomBits();
+	}
+	for (std::size_t n = 0; n <= 22; n++)
+	{
+		std::vector<GABinaryString::Word> d(23, 7), e(23, 7);
+		GABlendWords(d.data() + 1, a.data() + 1, b.data(), m.data() + 1, n);
+		GABlendWordsScalar(e.data() + 1, a.data() + 1, b.data(), m.data() + 1,
+						   n);
+		BOOST_CHECK(d == e);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(crossover_001)
+{
+	// the word-wide crossovers give the bits that counting through the genome
+	// one bit at a time gives
+	GARandomStream stream(8);
+	GARandomStreamScope scope(stream);
+
+	for (unsigned int len : {1U, 64U, 129U, 200U})
+	{
+		GA1DBinaryStringGenome mom(len), dad(len), sis(len), bro(len);
+		mom.randomize();
+		dad.randomize();
+		sis.score(1.0F);
+		GA1DBinaryStringGenome::EvenOddCrossover(mom, dad, &sis, &bro);
+		BOOST_CHECK(!sis.evaluated());
+		for (int i = len - 1, count = 0; i >= 0; i--, count++)
+		{
+			BOOST_CHECK_EQUAL(sis.gene(i), count % 2 == 0 ? mom.gene(i) : dad.gene(i));
+			BOOST_CHECK_EQUAL(bro.gene(i), count % 2 == 0 ? dad.gene(i) : mom.gene(i));
+		}
+
+		GA1DBinaryStringGenome::UniformCrossover(mom, dad, &sis, &bro);
+		for (unsigned int i = 0; i < len; i++)
+		{
+			BOOST_CHECK(sis.gene(i) == mom.gene(i) || sis.gene(i) == dad.gene(i));
+			BOOST_CHECK_EQUAL(sis.gene(i) + bro.gene(i), mom.gene(i) + dad.gene(i));
+		}
+	}
+
+	for (unsigned int w : {3U, 70U})
+	{
+		for (unsigned int h : {2U, 5U})
+		{
+			GA2DBinaryStringGenome mom(w, h), dad(w, h), sis(w, h), bro(w, h);
+			mom.randomize();
+			dad.randomize();
+			GA2DBinaryStringGenome::EvenOddCrossover(mom, dad, &sis, &bro);
+			GA2DBinaryStringGenome::EvenOddCrossover(dad, mom, &bro, nullptr);
+			int count = 0;
+			for (int i = w - 1; i >= 0; i--)
+			{
+				for (int j = h - 1; j >= 0; j--, count++)
+				{
+					BOOST_CHECK_EQUAL(sis.gene(i, j), count % 2 == 0 ? mom.gene(i, j)
+																	 : dad.gene(i, j));
+					BOOST_CHECK_EQUAL(bro.gene(i, j), count % 2 == 0 ? dad.gene(i, j)
+																	 : mom.gene(i, j));
+				}
+			}
+		}
+	}
+
+	for (unsigned int d : {2U, 3U})
+	{
+		GA3DBinaryStringGenome mom(67, 3, d), dad(67, 3, d), sis(67, 3, d),
+			bro(67, 3, d);
+		mom.randomize();
+		dad.randomize();
+		GA3DBinaryStringGenome::EvenOddCrossover(mom, dad, &sis, &bro);
+		int count = 0;
+		for (int i = 66; i >= 0; i--)
+		{
+			for (int j = 2; j >= 0; j--)
+			{
+				for (int k = d - 1; k >= 0; k--, count++)
+				{
+					BOOST_CHECK_EQUAL(sis.gene(i, j, k), count % 2 == 0
+															 ? mom.gene(i, j, k)
+															 : dad.gene(i, j, k));
+					BOOST_CHECK_EQUAL(bro.gene(i, j, k), count % 2 == 0
+															 ? dad.gene(i, j, k)
+															 : mom.gene(i, j, k));
+				}
+			}
+		}
+
+		GA3DBinaryStringGenome::UniformCrossover(mom, dad, &sis, &bro);
+		BOOST_CHECK_EQUAL(sis.count() + bro.count(), mom.count() + dad.count());
+	}
+}
+
 BOOST_AUTO_TEST_SUITE_END()
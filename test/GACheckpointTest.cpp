@@ -0,0 +1,267 @@
+#include <boost/test/unit_test.hpp>
+
+#include <GA1DArrayGenome.hpp>
+#include <GA1DBinStrGenome.h>
+#include <GADemeGA.h>
+#include <GASStateGA.h>
+#include <GASimpleGA.h>
+#include <garandom.h>
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+namespace
+{
+float ones(GAGenome &g)
+{
+	auto &genome = dynamic_cast<GA1DBinaryStringGenome &>(g);
+	float score = 0.0;
+	for (int i = 0; i < genome.length(); i++)
+	{
+		score += genome.gene(i);
+	}
+	return score;
+}
+
+// lots of ties, so the order of the sorts matters
+float blocks(GAGenome &g)
+{
+	auto &genome = dynamic_cast<GA1DBinaryStringGenome &>(g);
+	float score = 0.0;
+	for (int i = 0; i + 3 < genome.length(); i += 4)
+	{
+		score += (genome.gene(i) & genome.gene(i + 1) & genome.gene(i + 2) &
+				  genome.gene(i + 3));
+	}
+	return score;
+}
+
+float sphere(GAGenome &g)
+{
+	auto &genome = dynamic_cast<GA1DArrayGenome<float> &>(g);
+	float score = 0.0;
+	for (int i = 0; i < genome.length(); i++)
+	{
+		score += genome.gene(i) * genome.gene(i);
+	}
+	return score;
+}
+
+void spread(GAGenome &g)
+{
+	auto &genome = dynamic_cast<GA1DArrayGenome<float> &>(g);
+	for (int i = 0; i < genome.length(); i++)
+	{
+		genome.gene(i, GARandomFloat(-5.0F, 5.0F));
+	}
+}
+
+// the gaussian keeps a cached value between calls, which a checkpoint has to
+// carry along with the generator
+int nudge(GAGenome &g, float pmut)
+{
+	auto &genome = dynamic_cast<GA1DArrayGenome<float> &>(g);
+	int n = 0;
+	for (int i = 0; i < genome.length(); i++)
+	{
+		if (GAFlipCoin(pmut))
+		{
+			genome.gene(i, genome.gene(i) + GAGaussianFloat(0.5F));
+			n++;
+		}
+	}
+	return n;
+}
+
+void sameStatistics(const GAStatistics &a, const GAStatistics &b)
+{
+	BOOST_CHECK_EQUAL(a.generation(), b.generation());
+	BOOST_CHECK_EQUAL(a.online(), b.online());
+	BOOST_CHECK_EQUAL(a.offlineMax(), b.offlineMax());
+	BOOST_CHECK_EQUAL(a.offlineMin(), b.offlineMin());
+	BOOST_CHECK_EQUAL(a.convergence(), b.convergence());
+	BOOST_CHECK_EQUAL(a.numsel, b.numsel);
+	BOOST_CHECK_EQUAL(a.numcro, b.numcro);
+	BOOST_CHECK_EQUAL(a.nummut, b.nummut);
+	BOOST_CHECK_EQUAL(a.numrep, b.numrep);
+	BOOST_CHECK_EQUAL(a.numeval, b.numeval);
+	BOOST_CHECK_EQUAL(a.numpeval, b.numpeval);
+	BOOST_REQUIRE_EQUAL(a.nBestGenomes(), b.nBestGenomes());
+	for (int i = 0; i < a.nBestGenomes(); i++)
+	{
+		BOOST_CHECK(a.bestIndividual(i).equal(b.bestIndividual(i)));
+		BOOST_CHECK_EQUAL(a.bestIndividual(i).score(),
+						  b.bestIndividual(i).score());
+	}
+}
+
+void samePopulation(const GAPopulation &a, const GAPopulation &b)
+{
+	BOOST_REQUIRE_EQUAL(a.size(), b.size());
+	for (int i = 0; i < a.size(); i++)
+	{
+		BOOST_CHECK(a.individual(i).equal(b.individual(i)));
+		BOOST_CHECK_EQUAL(a.individual(i).score(), b.individual(i).score());
+	}
+}
+
+// Run a GA for n generations, or for k of them, then through a checkpoint
+// into another GA made the same way for the rest.  The random number
+// generator is mixed up in between so that only the checkpoint can put it
+// back.  (The GAs are set up from the same seed as well, since setting the
+// sizes of populations fills them with random genomes.)
+template <class GA, class Setup>
+void resume(const GAGenome &genome, Setup setup, int k, int n)
+{
+	GAResetRNG(31);
+	GA whole(genome);
+	setup(whole);
+	whole.initialize();
+	for (int i = 0; i < n; i++)
+	{
+		whole.step();
+	}
+
+	std::stringstream checkpoint;
+	{
+		GAResetRNG(31);
+		GA first(genome);
+		setup(first);
+		first.initialize();
+		for (int i = 0; i < k; i++)
+		{
+			first.step();
+		}
+		BOOST_REQUIRE_EQUAL(first.write(checkpoint), 0);
+	}
+	GAResetRNG(77);
+	GARandomFloat();
+
+	GA rest(genome);
+	setup(rest);
+	BOOST_REQUIRE_EQUAL(rest.read(checkpoint), 0);
+	BOOST_CHECK_EQUAL(rest.generation(), k);
+	for (int i = k; i < n; i++)
+	{
+		rest.step();
+	}
+
+	sameStatistics(whole.statistics(), rest.statistics());
+	samePopulation(whole.population(), rest.population());
+}
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(UnitTest)
+
+BOOST_AUTO_TEST_CASE(Checkpoint_001)
+{
+	// a resumed run makes the same generations as one that never stopped
+	GA1DBinaryStringGenome genome(64, blocks);
+	resume<GASimpleGA>(
+		genome,
+		[](GASimpleGA &ga) {
+			ga.populationSize(30);
+			ga.pMutation(0.02);
+			ga.nBestGenomes(4);
+			ga.elitist(true);
+			ga.scoreFrequency(1);
+			ga.flushFrequency(0);
+		},
+		13, 40);
+
+	GA1DArrayGenome<float> reals(8, sphere);
+	reals.initializer(spread);
+	reals.mutator(nudge);
+	resume<GASteadyStateGA>(
+		reals,
+		[](GASteadyStateGA &ga) {
+			ga.minimize();
+			ga.populationSize(20);
+			ga.nReplacement(5);
+			ga.pMutation(0.3);
+			ga.flushFrequency(0);
+		},
+		21, 50);
+}
+
+BOOST_AUTO_TEST_CASE(Checkpoint_002)
+{
+	// populations of a deme GA, each with its own statistics and number of
+	// replacements
+	GA1DBinaryStringGenome genome(40, ones);
+	auto setup = [](GADemeGA &ga) {
+		ga.nPopulations(3);
+		ga.populationSize(12);
+		ga.nReplacement(GADemeGA::ALL, 6);
+		ga.nMigration(2);
+		ga.migrationInterval(3);
+		ga.flushFrequency(0);
+	};
+	resume<GADemeGA>(genome, setup, 8, 20);
+
+	GADemeGA ga(genome);
+	setup(ga);
+	ga.nReplacement(1, 4);
+	GAResetRNG(5);
+	ga.initialize();
+	ga.step();
+	std::stringstream checkpoint;
+	BOOST_REQUIRE_EQUAL(ga.write(checkpoint), 0);
+	GADemeGA other(genome);
+	setup(other);
+	BOOST_REQUIRE_EQUAL(other.read(checkpoint), 0);
+	BOOST_CHECK_EQUAL(other.nReplacement(1), 4);
+	BOOST_CHECK_EQUAL(other.nReplacement(2), 6);
+	for (int i = 0; i < 3; i++)
+	{
+		samePopulation(ga.population(i), other.population(i));
+		sameStatistics(ga.statistics(i), other.statistics(i));
+	}
+}
+
+BOOST_AUTO_TEST_CASE(Checkpoint_003)
+{
+	// checkpoints in files replace the one before, and the parameters come
+	// with them
+	GA1DBinaryStringGenome genome(32, ones);
+	GASimpleGA ga(genome);
+	ga.populationSize(16);
+	ga.pCrossover(0.7);
+	ga.nGenerations(9);
+	ga.flushFrequency(0);
+	GAResetRNG(3);
+	ga.initialize();
+	ga.step();
+
+	std::string name = "GACheckpointTest.ckp";
+	BOOST_REQUIRE_EQUAL(ga.write(name.c_str()), 0);
+	ga.step();
+	BOOST_REQUIRE_EQUAL(ga.write(name.c_str()), 0);
+	BOOST_CHECK(!std::ifstream(name + ".tmp").good());
+
+	GASimpleGA other(genome);
+	other.flushFrequency(0);
+	BOOST_REQUIRE_EQUAL(other.read(name.c_str()), 0);
+	BOOST_CHECK_EQUAL(other.generation(), 2);
+	BOOST_CHECK_EQUAL(other.populationSize(), 16);
+	BOOST_CHECK_EQUAL(other.pCrossover(), 0.7F);
+	BOOST_CHECK_EQUAL(other.nGenerations(), 9);
+	samePopulation(ga.population(), other.population());
+	std::remove(name.c_str());
+
+	// checkpoints that are cut short or are of another GA are refused
+	std::stringstream full;
+	ga.write(full);
+	std::string buf = full.str();
+	std::istringstream cut(buf.substr(0, buf.size() - 10));
+	GASimpleGA third(genome);
+	BOOST_CHECK_NE(third.read(cut), 0);
+	std::istringstream wrong(buf);
+	GASteadyStateGA steady(genome);
+	BOOST_CHECK_NE(steady.read(wrong), 0);
+	BOOST_CHECK_NE(third.read("no such checkpoint"), 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,276 @@
+#include <boost/test/unit_test.hpp>
+
+#include <GA1DArrayGenome.hpp>
+#include <GA1DBinStrGenome.h>
+#include <GA2DArrayGenome.hpp>
+#include <GA2DBinStrGenome.h>
+#include <GA3DBinStrGenome.h>
+#include <GABin2DecGenome.h>
+#include <GACodec.h>
+#include <GAListGenome.hpp>
+#include <GAPopulation.h>
+#include <GARealGenome.h>
+#include <GAStringGenome.h>
+#include <GATreeGenome.hpp>
+#include <garandom.h>
+
+#include <sstream>
+#include <string>
+
+namespace
+{
+// Encode g, decode the record into h and check that h is now the same genome.
+void roundTrip(const GAGenome &g, GAGenome &h)
+{
+	std::string buf;
+	GAEncoder enc(buf);
+	g.encode(enc);
+	GADecoder dec(buf);
+	BOOST_REQUIRE(h.decode(dec));
+	BOOST_CHECK(dec.ok());
+	BOOST_CHECK_EQUAL(dec.left(), 0U);
+	BOOST_CHECK(h.equal(g));
+	BOOST_CHECK_EQUAL(h.evaluated(), g.evaluated());
+	if (g.evaluated())
+	{
+		BOOST_CHECK_EQUAL(h.score(), g.score());
+	}
+}
+
+float nbits(GAGenome &g)
+{
+	return static_cast<float>(dynamic_cast<GA1DBinaryStringGenome &>(g).count());
+}
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(UnitTest)
+
+BOOST_AUTO_TEST_CASE(Codec_001)
+{
+	std::string buf;
+	GAEncoder enc(buf);
+	enc.u8(200);
+	enc.value(-3);
+	enc.value(static_cast<short>(-2));
+	enc.value(0.1F);
+	enc.value(-1.0e300);
+	enc.value(true);
+	enc.u64(0x0123456789abcdefULL);
+	enc.text("genome");
+	BOOST_CHECK_EQUAL(buf.size(), 1U + 4 + 2 + 4 + 8 + 1 + 8 + 4 + 6);
+	BOOST_CHECK_EQUAL(buf[1], static_cast<char>(0xfd)); // least significant first
+
+	GADecoder dec(buf);
+	std::uint8_t a;
+	int b;
+	short c;
+	float d;
+	double e;
+	bool f;
+	std::uint64_t g;
+	std::string h;
+	BOOST_CHECK(dec.u8(a) && dec.value(b) && dec.value(c) && dec.value(d) &&
+				dec.value(e) && dec.value(f) && dec.u64(g) && dec.text(h));
+	BOOST_CHECK_EQUAL(a, 200);
+	BOOST_CHECK_EQUAL(b, -3);
+	BOOST_CHECK_EQUAL(c, -2);
+	BOOST_CHECK_EQUAL(d, 0.1F);
+	BOOST_CHECK_EQUAL(e, -1.0e300);
+	BOOST_CHECK(f);
+	BOOST_CHECK_EQUAL(g, 0x0123456789abcdefULL);
+	BOOST_CHECK_EQUAL(h, "genome");
+	BOOST_CHECK_EQUAL(dec.left(), 0U);
+
+	// running out is sticky
+	BOOST_CHECK(!dec.u8(a));
+	BOOST_CHECK(!dec.ok());
+	GADecoder cut(buf.data(), 3);
+	BOOST_CHECK(cut.u8(a));
+	BOOST_CHECK(!cut.value(b));
+	BOOST_CHECK(!cut.u8(a));
+}
+
+BOOST_AUTO_TEST_CASE(Codec_002)
+{
+	GAResetRNG(11);
+
+	// bit strings, with lengths that are not whole bytes or words
+	GA1DBinaryStringGenome b1(203, nbits), c1(5);
+	b1.initialize();
+	b1.evaluate();
+	roundTrip(b1, c1);
+	BOOST_CHECK_EQUAL(c1.length(), 203);
+	BOOST_CHECK_EQUAL(c1.hash(), b1.hash());
+
+	GA2DBinaryStringGenome b2(13, 7), c2(2, 2);
+	b2.initialize();
+	roundTrip(b2, c2);
+	BOOST_CHECK_EQUAL(c2.width(), 13);
+	BOOST_CHECK_EQUAL(c2.height(), 7);
+
+	GA3DBinaryStringGenome b3(5, 4, 3), c3(1, 1, 1);
+	b3.initialize();
+	b3.score(2.5F);
+	roundTrip(b3, c3);
+	BOOST_CHECK_EQUAL(c3.depth(), 3);
+
+	GABin2DecPhenotype map;
+	map.add(9, -1.0F, 1.0F);
+	map.add(21, 0.0F, 100.0F);
+	GABin2DecGenome bd(map), cd(map);
+	bd.initialize();
+	roundTrip(bd, cd);
+	BOOST_CHECK_EQUAL(cd.phenotype(1), bd.phenotype(1));
+
+	// the binary form is much smaller than the text
+	std::string buf;
+	GAEncoder enc(buf);
+	b1.encode(enc);
+	std::ostringstream os;
+	b1.write(os);
+	BOOST_CHECK(buf.size() * 4 < os.str().size());
+
+	// arrays of numbers, with and without alleles
+	GA1DArrayGenome<int> i1(6), j1(2);
+	for (int i = 0; i < 6; i++)
+	{
+		i1.gene(i, -1000 * i);
+	}
+	roundTrip(i1, j1);
+
+	GARealAlleleSet reals(-10.0F, 10.0F);
+	GARealGenome r1(17, reals), s1(3, reals);
+	for (int i = 0; i < 17; i++)
+	{
+		r1.gene(i, GARandomFloat(-10.0F, 10.0F));
+	}
+	r1.score(-4.0F);
+	roundTrip(r1, s1);
+	BOOST_CHECK_EQUAL(s1.length(), 17);
+
+	GAStringAlleleSet letters;
+	for (char ch = 'a'; ch <= 'z'; ch++)
+	{
+		letters.add(ch);
+	}
+	GAStringGenome t1(30, letters), u1(30, letters);
+	t1.initialize();
+	roundTrip(t1, u1);
+
+	GA2DArrayGenome<double> d2(4, 3), e2(1, 1);
+	for (int j = 0; j < 3; j++)
+	{
+		for (int i = 0; i < 4; i++)
+		{
+			d2.gene(i, j, i * 0.5 - j);
+		}
+	}
+	roundTrip(d2, e2);
+
+	// a list and a tree
+	GAListGenome<int> l1(nullptr), m1(nullptr);
+	m1.insert(99);
+	for (int i = 0; i < 7; i++)
+	{
+		l1.insert(i * i);
+	}
+	roundTrip(l1, m1);
+	BOOST_CHECK_EQUAL(m1.size(), 7);
+	BOOST_CHECK_EQUAL(*m1.head(), 0);
+	BOOST_CHECK_EQUAL(*m1.tail(), 36);
+
+	GATreeGenome<int> t2(nullptr), u2(nullptr);
+	t2.insert(1, GATreeBASE::ROOT);
+	t2.insert(2, GATreeBASE::BELOW);
+	t2.insert(3, GATreeBASE::AFTER);
+	t2.insert(4, GATreeBASE::BELOW);
+	t2.root();
+	t2.insert(5, GATreeBASE::BELOW);
+	u2.insert(8, GATreeBASE::ROOT);
+	roundTrip(t2, u2);
+	BOOST_CHECK_EQUAL(u2.size(), 5);
+	BOOST_CHECK_EQUAL(*u2.root(), 1);
+	BOOST_CHECK_EQUAL(u2.nchildren(), 3);
+	BOOST_CHECK_EQUAL(*u2.child(), 2);
+	BOOST_CHECK_EQUAL(*u2.next(), 3);
+	BOOST_CHECK_EQUAL(*u2.child(), 4);
+
+	GATreeGenome<int> empty(nullptr);
+	roundTrip(empty, u2);
+	BOOST_CHECK_EQUAL(u2.size(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(Codec_003)
+{
+	// records that do not fit are refused
+	GA1DBinaryStringGenome b1(100);
+	GAResetRNG(4);
+	b1.initialize();
+	std::string buf;
+	GAEncoder enc(buf);
+	b1.encode(enc);
+
+	GA2DBinaryStringGenome b2(10, 10);
+	GADecoder d2(buf);
+	BOOST_CHECK(!b2.decode(d2));
+	BOOST_CHECK(!d2.ok());
+
+	GA1DBinaryStringGenome small(10);
+	small.resizeBehaviour(10, 20);
+	GADecoder d3(buf);
+	BOOST_CHECK(!small.decode(d3));
+
+	GADecoder d4(buf.data(), buf.size() - 1);
+	BOOST_CHECK(!small.decode(d4));
+
+	std::string old(buf);
+	old[4] = 0; // an encoding of another version
+	GA1DBinaryStringGenome other(100);
+	GADecoder d5(old);
+	BOOST_CHECK(!other.decode(d5));
+}
+
+BOOST_AUTO_TEST_CASE(Codec_004)
+{
+	// populations, into populations of another size
+	GA1DBinaryStringGenome genome(70, nbits);
+	GAPopulation pop(genome, 25);
+	GAResetRNG(8);
+	pop.initialize();
+	pop.evaluate();
+
+	std::string buf;
+	GAEncoder enc(buf);
+	pop.encode(enc);
+
+	for (unsigned int size : {3U, 25U, 40U})
+	{
+		GAPopulation copy(genome, size);
+		GADecoder dec(buf);
+		BOOST_REQUIRE(copy.decode(dec));
+		BOOST_CHECK_EQUAL(dec.left(), 0U);
+		BOOST_REQUIRE_EQUAL(copy.size(), 25);
+		for (int i = 0; i < 25; i++)
+		{
+			BOOST_CHECK(copy.individual(i).equal(pop.individual(i)));
+			BOOST_CHECK(copy.individual(i).evaluated());
+			BOOST_CHECK_EQUAL(copy.individual(i).score(),
+							  pop.individual(i).score());
+		}
+		BOOST_CHECK_EQUAL(copy.max(), pop.max());
+	}
+
+	// one buffer can hold several populations, one after the other
+	GAPopulation more(genome, 5);
+	more.initialize();
+	more.encode(enc);
+	GADecoder dec(buf);
+	GAPopulation a(genome, 1), b(genome, 1);
+	BOOST_CHECK(a.decode(dec) && b.decode(dec));
+	BOOST_CHECK_EQUAL(a.size(), 25);
+	BOOST_CHECK_EQUAL(b.size(), 5);
+	BOOST_CHECK(!b.individual(0).evaluated());
+	BOOST_CHECK_EQUAL(dec.left(), 0U);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
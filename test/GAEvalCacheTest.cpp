@@ -0,0 +1,161 @@
+#include <boost/test/unit_test.hpp>
+
+#include <GA1DArrayGenome.hpp>
+#include <GA1DBinStrGenome.h>
+#include <GAEvalCache.h>
+#include <GAPopulation.h>
+#include <GASimpleGA.h>
+#include <garandom.h>
+#include <memory>
+
+namespace
+{
+int ncalls = 0;
+float countOnes(GAGenome &g)
+{
+	ncalls++;
+	auto &genome = dynamic_cast<GA1DBinaryStringGenome &>(g);
+	float score = 0.0;
+	for (int i = 0; i < genome.length(); i++)
+	{
+		score += genome.gene(i);
+	}
+	return score;
+}
+
+float sumInts(GAGenome &g)
+{
+	ncalls++;
+	auto &genome = dynamic_cast<GA1DArrayGenome<int> &>(g);
+	float score = 0.0;
+	for (int i = 0; i < genome.length(); i++)
+	{
+		score += genome.gene(i);
+	}
+	return score;
+}
+
+float sumOnes(GAGenome &g) { return 2 * countOnes(g); }
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(UnitTest)
+
+BOOST_AUTO_TEST_CASE(EvalCache_001)
+{
+	GAEvalCache cache(100, 4);
+	BOOST_CHECK_EQUAL(cache.capacity(), 100U);
+	float score = 0.0;
+	BOOST_CHECK(!cache.find(42, score));
+	cache.insert(42, 3.5F);
+	BOOST_CHECK(cache.find(42, score));
+	BOOST_CHECK_EQUAL(score, 3.5F);
+	cache.insert(42, 4.5F);
+	BOOST_CHECK(cache.find(42, score));
+	BOOST_CHECK_EQUAL(score, 4.5F);
+	BOOST_CHECK_EQUAL(cache.hits(), 2UL);
+	BOOST_CHECK_EQUAL(cache.misses(), 1UL);
+
+	// never holds more than its capacity
+	for (std::uint64_t k = 1; k <= 1000; k++)
+	{
+		cache.insert(k * 0x9e3779b97f4a7c15ULL, static_cast<float>(k));
+	}
+	BOOST_CHECK(cache.size() <= 100U);
+	BOOST_CHECK(cache.size() > 0U);
+
+	// whatever is still there has the right score
+	unsigned int found = 0;
+	for (std::uint64_t k = 1; k <= 1000; k++)
+	{
+		if (cache.find(k * 0x9e3779b97f4a7c15ULL, score))
+		{
+			BOOST_CHECK_EQUAL(score, static_cast<float>(k));
+			found++;
+		}
+	}
+	BOOST_CHECK_EQUAL(found, cache.size());
+
+	cache.clear();
+	BOOST_CHECK_EQUAL(cache.size(), 0U);
+	BOOST_CHECK_EQUAL(cache.hits(), 0UL);
+}
+
+BOOST_AUTO_TEST_CASE(EvalCache_002)
+{
+	// a genome seen before is not evaluated again, even by a new genome
+	GA1DBinaryStringGenome a(50, countOnes);
+	a.evalCache(std::make_shared<GAEvalCache>(64));
+	GAResetRNG(5);
+	a.initialize();
+	GA1DBinaryStringGenome b(a);
+	BOOST_CHECK(b.evalCache() == a.evalCache());
+	BOOST_CHECK_EQUAL(a.hash(), b.hash());
+
+	ncalls = 0;
+	float sa = a.evaluate();
+	b.initialize();
+	b.copy(a);
+	float sb = b.evaluate(true);
+	BOOST_CHECK_EQUAL(ncalls, 1);
+	BOOST_CHECK_EQUAL(sa, sb);
+	BOOST_CHECK_EQUAL(b.nevals(), 0);
+
+	// a different objective is a different key
+	b.evaluator(sumOnes);
+	BOOST_CHECK_EQUAL(b.evaluate(true), 2 * sa);
+	BOOST_CHECK_EQUAL(ncalls, 2);
+
+	// so is a different genotype
+	b.evaluator(countOnes);
+	b.gene(0, 1 - b.gene(0));
+	BOOST_CHECK(a.hash() != b.hash());
+	b.evaluate(true);
+	BOOST_CHECK_EQUAL(ncalls, 3);
+
+	GA1DArrayGenome<int> x(10, sumInts);
+	GA1DArrayGenome<int> y(10, sumInts);
+	x.evalCache(std::make_shared<GAEvalCache>(16));
+	y.evalCache(x.evalCache());
+	for (int i = 0; i < 10; i++)
+	{
+		x.gene(i, i);
+		y.gene(i, i);
+	}
+	ncalls = 0;
+	BOOST_CHECK_EQUAL(x.evaluate(), 45.0F);
+	BOOST_CHECK_EQUAL(y.evaluate(), 45.0F);
+	BOOST_CHECK_EQUAL(ncalls, 1);
+}
+
+BOOST_AUTO_TEST_CASE(EvalCache_003)
+{
+	// the cache changes how often the objective is called, not the result
+	GA1DBinaryStringGenome genome(24, countOnes);
+	GASimpleGA plain(genome);
+	genome.evalCache(std::make_shared<GAEvalCache>(4096));
+	GASimpleGA cached(genome);
+	GASimpleGA *gas[] = {&plain, &cached};
+	int calls[2];
+	for (int k = 0; k < 2; k++)
+	{
+		gas[k]->populationSize(30);
+		gas[k]->nGenerations(40);
+		gas[k]->pMutation(0.01);
+		gas[k]->nThreads(2);
+		ncalls = 0;
+		GAResetRNG(11);
+		gas[k]->evolve();
+		calls[k] = ncalls;
+	}
+	BOOST_CHECK_EQUAL(plain.statistics().bestIndividual().score(),
+					  cached.statistics().bestIndividual().score());
+	BOOST_CHECK_EQUAL(plain.statistics().online(),
+					  cached.statistics().online());
+	BOOST_CHECK(calls[1] < calls[0]);
+	BOOST_CHECK_EQUAL(plain.statistics().cacheHits(), 0UL);
+	BOOST_CHECK(cached.statistics().cacheHits() > 0UL);
+	BOOST_CHECK_EQUAL(cached.statistics().cacheMisses(),
+					  static_cast<unsigned long>(calls[1]));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
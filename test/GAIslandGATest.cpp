@@ -0,0 +1,264 @@
+#include <boost/test/unit_test.hpp>
+
+// the islands are POSIX processes
+#if !defined(_WIN32)
+
+#include <GA1DBinStrGenome.h>
+#include <GAIslandGA.h>
+#include <garandom.h>
+
+#include <algorithm>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+namespace
+{
+float ones(GAGenome &g)
+{
+	auto &genome = dynamic_cast<GA1DBinaryStringGenome &>(g);
+	float score = 0.0;
+	for (int i = 0; i < genome.length(); i++)
+	{
+		score += genome.gene(i);
+	}
+	return score;
+}
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(UnitTest)
+
+BOOST_AUTO_TEST_CASE(IslandGA_001)
+{
+	GA1DBinaryStringGenome genome(40, ones);
+	GAIslandGA ga(genome);
+	ga.nPopulations(3);
+	ga.populationSize(20);
+	ga.nGenerations(15);
+	ga.nMigration(2);
+	ga.migrationInterval(2);
+	ga.pMutation(0.01);
+
+	// a run on the islands gives the same result each time
+	float best[2], online[2];
+	for (int k = 0; k < 2; k++)
+	{
+		BOOST_REQUIRE_EQUAL(ga.spawn(), 3);
+		GAResetRNG(3);
+		ga.evolve();
+		BOOST_CHECK_EQUAL(ga.statistics().generation(), 15);
+		for (int i = 0; i < 3; i++)
+		{
+			BOOST_CHECK_EQUAL(ga.population(i).size(), 20);
+			BOOST_CHECK_EQUAL(ga.statistics(i).generation(), 15);
+			BOOST_CHECK(ga.statistics(i).selections() > 0);
+			BOOST_CHECK(ga.statistics(i).maxEver() >=
+						ga.statistics(i).initial(GAStatistics::Maximum));
+		}
+		best[k] = ga.statistics().bestIndividual().score();
+		online[k] = ga.statistics(1).online();
+		ga.reap();
+		BOOST_CHECK_EQUAL(ga.nIslands(), 0);
+	}
+	BOOST_CHECK_EQUAL(best[0], best[1]);
+	BOOST_CHECK_EQUAL(online[0], online[1]);
+	BOOST_CHECK(best[0] > 20.0F);
+}
+
+BOOST_AUTO_TEST_CASE(IslandGA_002)
+{
+	// islands that join over TCP, each with a GA of its own
+	GA1DBinaryStringGenome genome(30, ones);
+	GAIslandGA ga(genome);
+	ga.populationSize(16);
+	ga.nGenerations(10);
+	ga.migrationTopology(GADemeGA::FULL);
+	ga.nMigration(1);
+
+	int port = ga.listen(0);
+	BOOST_REQUIRE(port > 0);
+	pid_t pid[2];
+	for (auto &p : pid)
+	{
+		p = fork();
+		BOOST_REQUIRE(p >= 0);
+		if (p == 0)
+		{
+			GAIslandGA island(genome);
+			island.nPopulations(1);
+			island.populationSize(12);
+			_exit(island.join("localhost", static_cast<unsigned short>(port)));
+		}
+	}
+	BOOST_REQUIRE_EQUAL(ga.accept(2), 2);
+	BOOST_CHECK_EQUAL(ga.nPopulations(), 2);
+
+	GAResetRNG(5);
+	ga.evolve();
+	BOOST_CHECK_EQUAL(ga.statistics().generation(), 10);
+	for (int i = 0; i < 2; i++)
+	{
+		// the populations are the ones the islands made
+		BOOST_CHECK_EQUAL(ga.population(i).size(), 12);
+		BOOST_CHECK(ga.statistics(i).replacements() > 0);
+	}
+	ga.reap();
+
+	for (auto p : pid)
+	{
+		int status = -1;
+		BOOST_CHECK_EQUAL(waitpid(p, &status, 0), p);
+		BOOST_CHECK(WIFEXITED(status));
+		BOOST_CHECK_EQUAL(WEXITSTATUS(status), 0);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(IslandGA_003)
+{
+	// each island starts from a seed of its own, whatever the master's seed
+	GA1DBinaryStringGenome genome(64, ones);
+	GAIslandGA ga(genome);
+	ga.nPopulations(3);
+	ga.populationSize(10);
+	BOOST_REQUIRE_EQUAL(ga.spawn(), 3);
+	GAResetRNG(262144);
+	ga.initialize();
+	for (int i = 0; i < 3; i++)
+	{
+		for (int j = i + 1; j < 3; j++)
+		{
+			BOOST_CHECK(!ga.population(i).individual(0).equal(
+				ga.population(j).individual(0)));
+		}
+	}
+	ga.reap();
+}
+
+BOOST_AUTO_TEST_CASE(IslandGA_004)
+{
+	// migration is that of the deme GA: copies of the best of each island
+	// replace the worst of the next one
+	GA1DBinaryStringGenome genome(48, ones);
+	GAIslandGA ga(genome);
+	ga.nPopulations(3);
+	ga.populationSize(16);
+	ga.nMigration(3);
+	BOOST_REQUIRE_EQUAL(ga.spawn(), 3);
+	GAResetRNG(23);
+	ga.initialize();
+
+	float best[3];
+	std::vector<float> scores[3];
+	for (int i = 0; i < 3; i++)
+	{
+		best[i] = ga.population(i).best().score();
+		for (int j = 0; j < 16; j++)
+		{
+			scores[i].push_back(ga.population(i).individual(j).score());
+		}
+		std::sort(scores[i].begin(), scores[i].end());
+	}
+	ga.migrate();
+	for (int i = 0; i < 3; i++)
+	{
+		// what is left of the old population is its best 13
+		const GAPopulation &p = ga.population(i);
+		BOOST_CHECK_EQUAL(p.size(), 16);
+		BOOST_CHECK_EQUAL(p.best().score(),
+						  std::max(best[i], best[(i + 2) % 3]));
+		std::vector<float> now;
+		for (int j = 0; j < 16; j++)
+		{
+			now.push_back(p.individual(j).score());
+		}
+		std::sort(now.begin(), now.end());
+		std::vector<float> kept(scores[i].begin() + 3, scores[i].end());
+		BOOST_CHECK(std::includes(now.begin(), now.end(), kept.begin(),
+								  kept.end()));
+	}
+	ga.reap();
+}
+
+BOOST_AUTO_TEST_CASE(IslandGA_005)
+{
+	// the statistics come every generation, and a population when it is read
+	GA1DBinaryStringGenome genome(40, ones);
+	GAIslandGA ga(genome);
+	ga.nPopulations(2);
+	ga.populationSize(10);
+	ga.nMigration(1);
+	ga.migrationInterval(3);
+	BOOST_REQUIRE_EQUAL(ga.spawn(), 2);
+	GAResetRNG(9);
+	ga.initialize();
+	for (int k = 0; k < 5; k++)
+	{
+		ga.step();
+		for (int i = 0; i < 2; i++)
+		{
+			BOOST_CHECK_EQUAL(ga.statistics(i).generation(), k + 1);
+			BOOST_CHECK_EQUAL(ga.population(i).max(),
+							  ga.statistics(i).current(GAStatistics::Maximum));
+			BOOST_CHECK_EQUAL(ga.population(i).ave(),
+							  ga.statistics(i).current(GAStatistics::Mean));
+		}
+		BOOST_CHECK_EQUAL(ga.population().max(), ga.statistics().current());
+	}
+
+	// and what was evolved there is here after the islands are gone
+	ga.step();
+	float max = ga.statistics(1).current(GAStatistics::Maximum);
+	ga.reap();
+	BOOST_CHECK_EQUAL(ga.population(1).max(), max);
+}
+
+BOOST_AUTO_TEST_CASE(IslandGA_006)
+{
+	// an island that does not answer in time is given up on, and the GA
+	// carries on without islands
+	GA1DBinaryStringGenome genome(20, ones);
+	GAIslandGA ga(genome);
+	ga.populationSize(8);
+	ga.timeout(200);
+	int port = ga.listen(0);
+	BOOST_REQUIRE(port > 0);
+	pid_t pid = fork();
+	BOOST_REQUIRE(pid >= 0);
+	if (pid == 0)
+	{
+		// read the commands and say nothing until the master goes away
+		int fd = socket(AF_INET, SOCK_STREAM, 0);
+		sockaddr_in addr{};
+		addr.sin_family = AF_INET;
+		addr.sin_port = htons(static_cast<unsigned short>(port));
+		addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+		if (connect(fd, reinterpret_cast<sockaddr *>(&addr), sizeof(addr)) != 0)
+		{
+			_exit(1);
+		}
+		char c;
+		while (read(fd, &c, 1) > 0)
+		{
+		}
+		_exit(0);
+	}
+	BOOST_REQUIRE_EQUAL(ga.accept(1), 1);
+
+	GAResetRNG(4);
+	ga.initialize();
+	BOOST_CHECK_EQUAL(ga.nIslands(), 0);
+	ga.step();
+	BOOST_CHECK_EQUAL(ga.statistics().generation(), 1);
+	BOOST_CHECK_EQUAL(ga.population(0).size(), 8);
+
+	int status = -1;
+	BOOST_CHECK_EQUAL(waitpid(pid, &status, 0), pid);
+	BOOST_CHECK(WIFEXITED(status));
+	BOOST_CHECK_EQUAL(WEXITSTATUS(status), 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif
@@ -0,0 +1,149 @@
+#include <boost/test/unit_test.hpp>
+
+#include <GAList.hpp>
+#include <GATree.hpp>
+
+#include <set>
+#include <string>
+#include <vector>
+
+namespace
+{
+struct Unpooled
+{
+	int x;
+};
+} // namespace
+
+template <> struct GANodePooled<Unpooled> : std::false_type
+{
+};
+
+namespace
+{
+// a root with three children that have two children each
+template <class T> void grow(GATree<T> &tree, const std::vector<T> &v)
+{
+	tree.insert(v[0], GATreeBASE::ROOT);
+	for (int i = 0; i < 3; i++)
+	{
+		tree.root();
+		tree.insert(v[1 + 3 * i], GATreeBASE::BELOW);
+		tree.insert(v[2 + 3 * i], GATreeBASE::BELOW);
+		tree.parent();
+		tree.insert(v[3 + 3 * i], GATreeBASE::BELOW);
+	}
+}
+
+template <class T> std::vector<T> contents(GATree<T> &tree)
+{
+	std::vector<T> v;
+	for (int i = 0; i < tree.size(); i++)
+		v.push_back(*tree.warp(i));
+	return v;
+}
+
+template <class T> std::set<const T *> places(GATree<T> &tree)
+{
+	std::set<const T *> s;
+	for (int i = 0; i < tree.size(); i++)
+		s.insert(tree.warp(i));
+	return s;
+}
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(UnitTest)
+
+BOOST_AUTO_TEST_CASE(GANodePool_001)
+{
+	// the nodes of a list that is gone are used for the next one
+	std::set<const int *> old;
+	{
+		GAList<int> list;
+		list.insert(0, GAListBASE::HEAD);
+		for (int i = 1; i < 20; i++)
+			list.insert(i);
+		for (int i = 0; i < 20; i++)
+			old.insert(list.warp(i));
+	}
+	GAList<int> list;
+	list.insert(100, GAListBASE::HEAD);
+	for (int i = 1; i < 20; i++)
+		list.insert(100 + i);
+	for (int i = 0; i < 20; i++)
+	{
+		BOOST_CHECK_EQUAL(*list.warp(i), 100 + i);
+		BOOST_CHECK(old.count(list.warp(i)) == 1);
+	}
+
+	GAList<int> copy(list);
+	list.copy(copy);
+	BOOST_CHECK_EQUAL(list.size(), 20);
+	for (int i = 0; i < 20; i++)
+		BOOST_CHECK_EQUAL(*list.warp(i), 100 + i);
+}
+
+BOOST_AUTO_TEST_CASE(GANodePool_002)
+{
+	// a tree given back whole is handed out again a node at a time, and the
+	// trees that are still around are not touched
+	std::vector<int> v;
+	for (int i = 0; i < 10; i++)
+		v.push_back(i);
+	auto *tree = new GATree<int>;
+	grow(*tree, v);
+	GATree<int> copy(*tree);
+	BOOST_CHECK_EQUAL(copy.size(), 10);
+	std::vector<int> before = contents(copy);
+	std::set<const int *> old = places(*tree);
+	delete tree;
+
+	GATree<int> other;
+	std::vector<int> w;
+	for (int i = 0; i < 10; i++)
+		w.push_back(-i);
+	grow(other, w);
+	BOOST_CHECK(places(other) == old);
+	BOOST_CHECK(contents(other) != before);
+	BOOST_CHECK(contents(copy) == before);
+
+	// part of a tree
+	other.root();
+	other.child();
+	BOOST_CHECK_EQUAL(other.destroy(), GATreeBASE::NO_ERR);
+	BOOST_CHECK_EQUAL(other.size(), 7);
+	BOOST_CHECK(contents(copy) == before);
+}
+
+BOOST_AUTO_TEST_CASE(GANodePool_003)
+{
+	// contents with destructors are destroyed when the tree is given back
+	std::vector<std::string> v;
+	for (int i = 0; i < 10; i++)
+		v.push_back(std::string(40, static_cast<char>('a' + i)));
+	GATree<std::string> keep;
+	{
+		GATree<std::string> tree;
+		grow(tree, v);
+		keep = tree;
+	}
+	GATree<std::string> again;
+	grow(again, v);
+	BOOST_CHECK(contents(again) == contents(keep));
+
+	GAList<std::string> list;
+	list.insert(v[0], GAListBASE::HEAD);
+	list.insert(v[1]);
+	GAList<std::string> other(list);
+	BOOST_CHECK_EQUAL(*other.warp(1), v[1]);
+
+	// and types that want nothing to do with the pool can say so
+	BOOST_CHECK(!GANodePool<Unpooled>::enabled);
+	GATree<Unpooled> plain;
+	plain.insert(Unpooled{1}, GATreeBASE::ROOT);
+	plain.insert(Unpooled{2}, GATreeBASE::BELOW);
+	GATree<Unpooled> same(plain);
+	BOOST_CHECK_EQUAL(same.size(), 2);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,698 @@
+#include <boost/test/unit_test.hpp>
+
+#include <GA1DBinStrGenome.h>
+#include <GAAsyncGA.h>
+#include <GADemeGA.h>
+#include <GASimpleGA.h>
+#include <GAPopulation.h>
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <cmath>
+#include <garandom.h>
+#include <limits>
+#include <mutex>
+#include <vector>
+
+namespace
+{
+float countOnes(GAGenome &g)
+{
+	auto &genome = dynamic_cast<GA1DBinaryStringGenome &>(g);
+	float score = 0;
+	for (int i = 0; i < genome.length(); i++)
+	{
+		score += genome.gene(i);
+	}
+	return score;
+}
+
+int ncalls = 0;
+float countCalls(GAGenome &g)
+{
+	ncalls++;
+	return countOnes(g);
+}
+
+std::atomic<int> nasync(0);
+float countOnesAsync(GAGenome &g)
+{
+	nasync++;
+	return countOnes(g);
+}
+
+// what the mutator drew from the random stream of each worker
+std::mutex drawLock;
+std::vector<double> draws;
+int recordDraw(GAGenome &, float)
+{
+	double x = GARandomDouble();
+	std::lock_guard<std::mutex> lock(drawLock);
+	draws.push_back(x);
+	return 0;
+}
+
+// a quarter or so of the genomes have no score that means anything
+float onesOrNaN(GAGenome &g)
+{
+	auto &genome = dynamic_cast<GA1DBinaryStringGenome &>(g);
+	if (genome.gene(0) != 0 && genome.gene(1) != 0)
+	{
+		return std::numeric_limits<float>::quiet_NaN();
+	}
+	return countOnes(g);
+}
+
+int ncompared = 0;
+float countingComparator(const GAGenome &a, const GAGenome &b)
+{
+	ncompared++;
+	return GA1DBinaryStringGenome::BitComparator(a, b);
+}
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(UnitTest)
+
+BOOST_AUTO_TEST_CASE(ParallelEvaluator_001)
+{
+	GA1DBinaryStringGenome genome(64, countOnes);
+	GAResetRNG(1);
+	GAPopulation pop1(genome, 200);
+	pop1.initialize();
+	GAPopulation pop2(pop1);
+
+	pop1.evaluate(true);
+
+	pop2.nThreads(4);
+	pop2.evaluator(GAPopulation::ParallelEvaluator);
+	pop2.evaluate(true);
+
+	for (int i = 0; i < pop1.size(); i++)
+	{
+		BOOST_CHECK_EQUAL(pop1.individual(i).score(), pop2.individual(i).score());
+		BOOST_CHECK_EQUAL(pop2.individual(i).nevals(), 1);
+	}
+
+	// already evaluated genomes are skipped
+	pop2.evaluate(true);
+	for (int i = 0; i < pop2.size(); i++)
+	{
+		BOOST_CHECK_EQUAL(pop2.individual(i).nevals(), 1);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(ParallelEvaluator_002)
+{
+	GA1DBinaryStringGenome genome(32, countOnes);
+
+	GASimpleGA ga1(genome);
+	ga1.nGenerations(20);
+	ga1.evolve(7);
+
+	GASimpleGA ga2(genome);
+	ga2.nGenerations(20);
+	ga2.set(gaNnThreads, 4);
+	BOOST_CHECK_EQUAL(ga2.nThreads(), 4);
+	BOOST_CHECK(ga2.population().evaluator() == GAPopulation::ParallelEvaluator);
+	GAResetRNG(1); // force a re-seed in evolve
+	ga2.evolve(7);
+
+	BOOST_CHECK_EQUAL(ga1.statistics().bestIndividual().score(),
+					  ga2.statistics().bestIndividual().score());
+	BOOST_CHECK_EQUAL(ga1.statistics().offlineMax(), ga2.statistics().offlineMax());
+}
+
+BOOST_AUTO_TEST_CASE(ParallelBreeding_001)
+{
+	GA1DBinaryStringGenome genome(64, countOnes);
+
+	// the same seed and thread count give the same run
+	std::vector<float> best;
+	std::vector<unsigned long int> counts;
+	for (int run = 0; run < 2; run++)
+	{
+		GASimpleGA ga(genome);
+		ga.populationSize(51); // odd, and not a multiple of the threads
+		ga.nGenerations(30);
+		ga.pMutation(0.01);
+		ga.set(gaNnThreads, 4);
+		ga.set(gaNparallelBreeding, 1);
+		BOOST_CHECK(ga.parallelBreeding());
+		GAResetRNG(1);
+		ga.evolve(11);
+
+		const GAStatistics &stats = ga.statistics();
+		BOOST_CHECK_EQUAL(stats.selections(), 30UL * 52);
+		BOOST_CHECK(stats.crossovers() > 0);
+		BOOST_CHECK(stats.mutations() > 0);
+		for (int i = 0; i < ga.population().size(); i++)
+		{
+			best.push_back(ga.population().individual(i).score());
+		}
+		counts.push_back(stats.crossovers());
+		counts.push_back(stats.mutations());
+		counts.push_back(stats.indEvals());
+	}
+	BOOST_CHECK(std::equal(best.begin(), best.begin() + 51, best.begin() + 51));
+	BOOST_CHECK_EQUAL(counts[0], counts[3]);
+	BOOST_CHECK_EQUAL(counts[1], counts[4]);
+	BOOST_CHECK_EQUAL(counts[2], counts[5]);
+}
+
+BOOST_AUTO_TEST_CASE(ParallelBreeding_002)
+{
+	// every generation breeds from new streams, even for seeds that are all
+	// zeros in their low bits
+	GA1DBinaryStringGenome genome(16, countOnes);
+	genome.mutator(recordDraw);
+	GASimpleGA ga(genome);
+	ga.populationSize(20);
+	ga.pCrossover(0.0);
+	ga.pMutation(0.5);
+	ga.set(gaNnThreads, 4);
+	ga.set(gaNparallelBreeding, 1);
+	GAResetRNG(262144);
+	ga.initialize();
+
+	std::vector<std::vector<double>> gen;
+	for (int i = 0; i < 2; i++)
+	{
+		draws.clear();
+		ga.step();
+		std::sort(draws.begin(), draws.end());
+		gen.push_back(draws);
+	}
+	BOOST_REQUIRE(!gen[0].empty());
+	BOOST_CHECK(gen[0] != gen[1]);
+}
+
+BOOST_AUTO_TEST_CASE(Inherit_001)
+{
+	GA1DBinaryStringGenome mom(32, countCalls);
+	GA1DBinaryStringGenome dad(32, countCalls);
+	GA1DBinaryStringGenome kid(32, countCalls);
+	GAResetRNG(17);
+	mom.initialize();
+	dad.copy(mom);
+	mom.evaluate();
+	dad.evaluate();
+
+	// crossing two identical parents gives a child that needs no evaluation
+	GA1DBinaryStringGenome::OnePointCrossover(mom, dad, &kid, nullptr);
+	BOOST_CHECK(!kid.evaluated());
+	std::uint64_t stamp = kid.stamp();
+	BOOST_CHECK(kid.inherit(mom));
+	BOOST_CHECK(kid.evaluated());
+	BOOST_CHECK(kid.stamp() != stamp);
+	ncalls = 0;
+	BOOST_CHECK_EQUAL(kid.score(), mom.score());
+	BOOST_CHECK_EQUAL(ncalls, 0);
+
+	// but one that differs does
+	kid.gene(0, 1 - kid.gene(0));
+	BOOST_CHECK(!kid.inherit(mom));
+	BOOST_CHECK(!kid.evaluated());
+
+	// in a population that has converged nothing is evaluated after the start
+	GA1DBinaryStringGenome genome(32, countCalls);
+	genome.initializer(GA1DBinaryStringGenome::SetInitializer);
+	GASimpleGA ga(genome);
+	ga.populationSize(40);
+	ga.nGenerations(10);
+	ga.pCrossover(1.0);
+	ga.pMutation(0.0);
+	ncalls = 0;
+	ga.evolve(3);
+	BOOST_CHECK_EQUAL(ncalls, 40);
+	BOOST_CHECK_EQUAL(ga.statistics().indEvals(), 40UL);
+}
+
+BOOST_AUTO_TEST_CASE(AsyncSteadyState_001)
+{
+	GA1DBinaryStringGenome genome(64, countOnesAsync);
+	GAAsyncSteadyStateGA ga(genome);
+	ga.populationSize(40);
+	ga.nReplacement(5);
+	ga.nGenerations(60);
+	ga.nThreads(4);
+	ga.nInFlight(6);
+	GAResetRNG(21);
+	nasync = 0;
+	ga.evolve();
+
+	const GAStatistics &stats = ga.statistics();
+	BOOST_CHECK_EQUAL(ga.population().size(), 40);
+	BOOST_CHECK_EQUAL(stats.replacements(), 60UL * 5);
+	BOOST_CHECK(stats.bestIndividual().score() > stats.initial());
+	BOOST_CHECK(ga.evaluations() <= 60UL * 5 + 6);
+	BOOST_CHECK_EQUAL(stats.indEvals(), 40 + ga.evaluations());
+	// the children still in flight at the end have been evaluated too
+	BOOST_CHECK(nasync.load() >= static_cast<int>(stats.indEvals()));
+	BOOST_CHECK(nasync.load() <= static_cast<int>(stats.indEvals()) + 6);
+	BOOST_CHECK(ga.evalsPerSecond() > 0.0);
+	for (int i = 0; i < ga.population().size(); i++)
+	{
+		BOOST_CHECK(ga.population().individual(i).evaluated());
+	}
+
+	// one evaluation at a time is the same from run to run
+	float online[2];
+	for (float &on : online)
+	{
+		GAAsyncSteadyStateGA serial(genome);
+		serial.populationSize(30);
+		serial.nGenerations(50);
+		serial.nInFlight(1);
+		GAResetRNG(8);
+		serial.evolve();
+		on = serial.statistics().online();
+	}
+	BOOST_CHECK_EQUAL(online[0], online[1]);
+}
+
+BOOST_AUTO_TEST_CASE(Exchange_001)
+{
+	GA1DBinaryStringGenome genome(40, countOnes);
+	GAResetRNG(19);
+	GAPopulation pop(genome, 60);
+	pop.initialize();
+	pop.evaluate();
+	float worst = pop.worst().score();
+	pop.best(3); // leave the population partly ranked
+
+	// a genome that beats everything takes the worst one's place
+	GA1DBinaryStringGenome *ones = new GA1DBinaryStringGenome(genome);
+	ones->set(0, 40);
+	ones->evaluate();
+	GAGenome *out = pop.exchange(ones);
+	BOOST_CHECK_EQUAL(out->score(), worst);
+	delete out;
+	BOOST_CHECK(&pop.best() == ones);
+
+	// and one that loses to everything goes to the bottom
+	GA1DBinaryStringGenome *zeros = new GA1DBinaryStringGenome(genome);
+	zeros->unset(0, 40);
+	zeros->evaluate();
+	delete pop.exchange(zeros, &pop.individual(30));
+	BOOST_CHECK(&pop.worst() == zeros);
+	BOOST_CHECK_EQUAL(pop.size(), 60);
+
+	// whatever is still ranked agrees with a full sort
+	std::vector<float> ranked;
+	for (int i = 0; i < pop.size(); i++)
+	{
+		ranked.push_back(pop.best(i).score());
+	}
+	pop.sort(true);
+	for (int i = 0; i < pop.size(); i++)
+	{
+		BOOST_CHECK_EQUAL(ranked[i], pop.individual(i).score());
+	}
+}
+
+BOOST_AUTO_TEST_CASE(DemeGA_001)
+{
+	// the demes run on their own random streams, so the number of threads
+	// makes no difference
+	GA1DBinaryStringGenome genome(48, countOnes);
+	std::vector<float> online[2];
+	unsigned int threads[] = {1, 4};
+	for (int k = 0; k < 2; k++)
+	{
+		GADemeGA ga(genome);
+		ga.nPopulations(5);
+		ga.populationSize(20);
+		ga.nGenerations(30);
+		ga.migrationTopology(GADemeGA::RANDOM);
+		ga.migrationInterval(3);
+		ga.nThreads(threads[k]);
+		GAResetRNG(13);
+		ga.evolve();
+		for (int i = 0; i < ga.nPopulations(); i++)
+		{
+			online[k].push_back(ga.statistics(i).online());
+			online[k].push_back(ga.population(i).best().score());
+		}
+	}
+	BOOST_CHECK(online[0] == online[1]);
+}
+
+BOOST_AUTO_TEST_CASE(DemeGA_002)
+{
+	// after a full migration every deme has the best of all of them
+	GA1DBinaryStringGenome genome(48, countOnes);
+	GADemeGA ga(genome);
+	ga.nPopulations(4);
+	ga.populationSize(20);
+	ga.nMigration(1);
+	ga.migrationTopology(GADemeGA::FULL);
+	ga.nThreads(3);
+	GAResetRNG(7);
+	ga.initialize();
+	for (int k = 0; k < 5; k++)
+	{
+		ga.step();
+		float top = ga.population(0U).best().score();
+		for (int i = 1; i < ga.nPopulations(); i++)
+		{
+			BOOST_CHECK_EQUAL(ga.population(i).best().score(), top);
+		}
+	}
+
+	// with no migration the demes stay apart
+	GADemeGA apart(genome);
+	apart.nPopulations(4);
+	apart.migrationInterval(0);
+	GAResetRNG(7);
+	apart.initialize();
+	for (int k = 0; k < 5; k++)
+	{
+		apart.step();
+	}
+	BOOST_CHECK_EQUAL(apart.statistics().generation(), 5);
+
+	ga.migrationTopology(17);
+	BOOST_CHECK_EQUAL(ga.migrationTopology(), static_cast<int>(GADemeGA::FULL));
+}
+
+BOOST_AUTO_TEST_CASE(DemeGA_003)
+{
+	// on the ring copies of the best of each deme replace the worst of the
+	// next one, and the worst leave the GA
+	GA1DBinaryStringGenome genome(48, countOnes);
+	GADemeGA ga(genome);
+	ga.nPopulations(4);
+	ga.populationSize(16);
+	ga.nMigration(3);
+	GAResetRNG(23);
+	ga.initialize();
+	auto everyone = [&ga]() {
+		std::vector<const GAGenome *> v;
+		for (int i = 0; i < ga.nPopulations(); i++)
+		{
+			for (int j = 0; j < ga.population(i).size(); j++)
+			{
+				v.push_back(&ga.population(i).individual(j));
+			}
+		}
+		std::sort(v.begin(), v.end());
+		return v;
+	};
+
+	std::vector<std::vector<float>> best(4);
+	std::vector<std::vector<const GAGenome *>> worst(4);
+	for (unsigned int i = 0; i < 4; i++)
+	{
+		for (int j = 0; j < 3; j++)
+		{
+			best[i].push_back(ga.population(i).best(j).score());
+			worst[i].push_back(&ga.population(i).worst(j));
+		}
+	}
+	ga.migrate();
+	for (unsigned int i = 0; i < 4; i++)
+	{
+		const GAPopulation &p = ga.population(i);
+		BOOST_CHECK_EQUAL(p.best().score(),
+						  std::max(best[i][0], best[(i + 3) % 4][0]));
+		BOOST_CHECK_EQUAL(p.size(), 16);
+	}
+	std::vector<const GAGenome *> first = everyone();
+	for (auto &w : worst)
+	{
+		for (const GAGenome *g : w)
+		{
+			BOOST_CHECK(!std::binary_search(first.begin(), first.end(), g));
+		}
+	}
+
+	// the next migration reuses the genomes the last one pushed out
+	ga.migrate();
+	std::vector<const GAGenome *> second = everyone();
+	for (auto &w : worst)
+	{
+		first.insert(first.end(), w.begin(), w.end());
+	}
+	std::sort(first.begin(), first.end());
+	BOOST_CHECK(std::includes(first.begin(), first.end(), second.begin(),
+							  second.end()));
+}
+
+BOOST_AUTO_TEST_CASE(DemeGA_004)
+{
+	// the demes get new streams every generation, even for seeds that are all
+	// zeros in their low bits
+	GA1DBinaryStringGenome genome(16, countOnes);
+	genome.mutator(recordDraw);
+	GADemeGA ga(genome);
+	ga.nPopulations(3);
+	ga.populationSize(10);
+	ga.pMutation(0.5);
+	ga.migrationInterval(0);
+	ga.nThreads(2);
+	GAResetRNG(262144);
+	ga.initialize();
+
+	std::vector<std::vector<double>> gen;
+	for (int i = 0; i < 2; i++)
+	{
+		draws.clear();
+		ga.step();
+		std::sort(draws.begin(), draws.end());
+		gen.push_back(draws);
+	}
+	BOOST_REQUIRE(!gen[0].empty());
+	BOOST_CHECK(gen[0] != gen[1]);
+}
+
+BOOST_AUTO_TEST_CASE(Diversity_001)
+{
+	// more than one tile, and not a multiple of the tile size
+	GA1DBinaryStringGenome genome(40, countOnes);
+	GAResetRNG(3);
+	GAPopulation pop(genome, 150);
+	pop.initialize();
+
+	double sum = 0.0;
+	for (int i = 0; i < pop.size(); i++)
+	{
+		BOOST_CHECK_EQUAL(pop.div(i, i), 0.0F);
+		for (int j = i + 1; j < pop.size(); j++)
+		{
+			float d = pop.individual(i).compare(pop.individual(j));
+			BOOST_CHECK_EQUAL(pop.div(i, j), d);
+			BOOST_CHECK_EQUAL(pop.div(j, i), d);
+			sum += d;
+		}
+	}
+	BOOST_CHECK_CLOSE(pop.div(), sum / (150 * 149 / 2), 1e-4);
+
+	GAPopulation pop2(pop);
+	pop2.nThreads(4);
+	pop2.diversity(true);
+	BOOST_CHECK_EQUAL(pop.div(), pop2.div());
+}
+
+BOOST_AUTO_TEST_CASE(Diversity_002)
+{
+	GA1DBinaryStringGenome genome(40, countOnes, nullptr);
+	genome.comparator(countingComparator);
+	GAResetRNG(9);
+	GAPopulation pop(genome, 100);
+	pop.initialize();
+	pop.evaluate();
+	pop.diversity();
+
+	// replacing a few genomes only compares those against the rest
+	for (int k = 0; k < 3; k++)
+	{
+		GAGenome *g = pop.individual(0).clone();
+		g->initialize();
+		delete pop.replace(g, GAPopulation::RANDOM);
+	}
+	pop.evaluate();
+	pop.sort(true);
+	ncompared = 0;
+	float div = pop.div();
+	BOOST_CHECK(ncompared <= 3 * 100);
+	BOOST_CHECK(ncompared >= 3 * 97);
+
+	double sum = 0.0;
+	for (int i = 0; i < pop.size(); i++)
+	{
+		for (int j = i + 1; j < pop.size(); j++)
+		{
+			float d = GA1DBinaryStringGenome::BitComparator(pop.individual(i),
+															pop.individual(j));
+			BOOST_CHECK_EQUAL(pop.div(i, j), d);
+			sum += d;
+		}
+	}
+	BOOST_CHECK_CLOSE(div, sum / (100 * 99 / 2), 1e-3);
+
+	// a genome that is changed in place and then copied is seen as new
+	pop.individual(5).copy(pop.individual(6));
+	pop.evaluate(true);
+	BOOST_CHECK_EQUAL(pop.div(5, 6), 0.0F);
+
+	// removing genomes needs no comparisons at all
+	delete pop.remove(GAPopulation::WORST);
+	ncompared = 0;
+	pop.diversity();
+	BOOST_CHECK_EQUAL(ncompared, 0);
+	BOOST_CHECK_EQUAL(pop.div(0, 1), GA1DBinaryStringGenome::BitComparator(
+										 pop.individual(0), pop.individual(1)));
+}
+
+BOOST_AUTO_TEST_CASE(Ranking_001)
+{
+	GA1DBinaryStringGenome genome(64, countOnes);
+	GAResetRNG(13);
+	GAPopulation pop(genome, 300);
+	pop.initialize();
+	pop.evaluate();
+
+	std::vector<float> scores;
+	for (int i = 0; i < pop.size(); i++)
+	{
+		scores.push_back(pop.individual(i).score());
+	}
+	std::sort(scores.begin(), scores.end(), std::greater<float>());
+
+	// the ends can be asked for in any order
+	BOOST_CHECK_EQUAL(pop.best().score(), scores.front());
+	BOOST_CHECK_EQUAL(pop.worst().score(), scores.back());
+	for (int i = 0; i < 20; i++)
+	{
+		BOOST_CHECK_EQUAL(pop.best(i).score(), scores[i]);
+		BOOST_CHECK_EQUAL(pop.worst(i).score(), scores[scores.size() - 1 - i]);
+	}
+
+	// a full sort after partial ranking still gives the whole order
+	pop.sort();
+	for (int i = 0; i < pop.size(); i++)
+	{
+		BOOST_CHECK_EQUAL(pop.individual(i).score(), scores[i]);
+	}
+
+	// removing the worst over and over, as the steady-state GA does
+	pop.touch();
+	for (int i = 0; i < 100; i++)
+	{
+		GAGenome *g = pop.remove(GAPopulation::WORST);
+		BOOST_CHECK_EQUAL(g->score(), scores[scores.size() - 1 - i]);
+		delete g;
+	}
+	BOOST_CHECK_EQUAL(pop.best().score(), scores.front());
+
+	// low is best
+	pop.order(GAPopulation::LOW_IS_BEST);
+	BOOST_CHECK_EQUAL(pop.best().score(), scores[199]);
+	BOOST_CHECK_EQUAL(pop.worst().score(), scores.front());
+}
+
+BOOST_AUTO_TEST_CASE(Ranking_002)
+{
+	// NaN scores are the worst whichever way the order goes
+	GA1DBinaryStringGenome genome(32, onesOrNaN);
+	GAResetRNG(29);
+	GAPopulation pop(genome, 60);
+	pop.initialize();
+	pop.evaluate();
+
+	std::vector<float> scores;
+	int nan = 0;
+	for (int i = 0; i < pop.size(); i++)
+	{
+		float x = pop.individual(i).score();
+		if (std::isnan(x))
+		{
+			nan++;
+		}
+		else
+		{
+			scores.push_back(x);
+		}
+	}
+	BOOST_REQUIRE(nan > 0 && nan < pop.size());
+	std::sort(scores.begin(), scores.end(), std::greater<float>());
+
+	BOOST_CHECK_EQUAL(pop.best().score(), scores.front());
+	for (int i = 0; i < nan; i++)
+	{
+		BOOST_CHECK(std::isnan(pop.worst(i).score()));
+	}
+	BOOST_CHECK_EQUAL(pop.worst(nan).score(), scores.back());
+
+	pop.sort();
+	for (int i = 0; i < pop.size(); i++)
+	{
+		float x = pop.individual(i).score();
+		if (i < static_cast<int>(scores.size()))
+		{
+			BOOST_CHECK_EQUAL(x, scores[i]);
+		}
+		else
+		{
+			BOOST_CHECK(std::isnan(x));
+		}
+	}
+
+	pop.order(GAPopulation::LOW_IS_BEST);
+	BOOST_CHECK_EQUAL(pop.best().score(), scores.back());
+	BOOST_CHECK(std::isnan(pop.worst().score()));
+	GAGenome *g = pop.remove(GAPopulation::WORST);
+	BOOST_CHECK(std::isnan(g->score()));
+	delete g;
+}
+
+BOOST_AUTO_TEST_CASE(Sharing_001)
+{
+	GA1DBinaryStringGenome genome(40, countOnes);
+	GAResetRNG(5);
+	GAPopulation pop(genome, 100);
+	pop.initialize();
+	pop.evaluate(true);
+
+	// reference: the distances computed directly
+	const float sigma = 0.4F;
+	std::vector<float> ref(pop.size());
+	for (int i = 0; i < pop.size(); i++)
+	{
+		double sum = 0.0;
+		for (int j = 0; j < pop.size(); j++)
+		{
+			float d = pop.individual(i).compare(pop.individual(j));
+			if (d < sigma)
+			{
+				sum += 1.0 - d / sigma;
+			}
+		}
+		ref[i] = static_cast<float>(pop.individual(i).score() / sum);
+	}
+
+	// with the genome's own comparator the population's table is used
+	std::vector<const GAGenome *> who(pop.size());
+	for (int i = 0; i < pop.size(); i++)
+	{
+		who[i] = &pop.individual(i);
+	}
+	pop.scaling(GASharing(GA1DBinaryStringGenome::BitComparator, sigma));
+	pop.scale(true);
+	for (int i = 0; i < pop.size(); i++)
+	{
+		BOOST_CHECK_CLOSE(pop.individual(i).fitness(), ref[i], 1e-4);
+	}
+
+	// still right after the population has been reordered
+	pop.sort(true, GAPopulation::RAW);
+	BOOST_CHECK(&pop.individual(0) != who[0] || &pop.individual(1) != who[1]);
+	pop.scale(true);
+	for (int i = 0; i < pop.size(); i++)
+	{
+		auto k = std::find(who.begin(), who.end(), &pop.individual(i)) - who.begin();
+		BOOST_CHECK_CLOSE(pop.individual(i).fitness(), ref[k], 1e-4);
+	}
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,182 @@
+#include <boost/test/unit_test.hpp>
+
+// the workers are POSIX processes
+#if !defined(_WIN32)
+
+#include <GA1DBinStrGenome.h>
+#include <GAProcessPool.h>
+#include <GASimpleGA.h>
+#include <garandom.h>
+
+#include <algorithm>
+#include <set>
+#include <unistd.h>
+
+namespace
+{
+int ncalls = 0;
+
+float countOnes(GAGenome &g)
+{
+	ncalls++;
+	auto &genome = dynamic_cast<GA1DBinaryStringGenome &>(g);
+	float score = 0.0;
+	for (int i = 0; i < genome.length(); i++)
+	{
+		score += genome.gene(i);
+	}
+	return score;
+}
+
+float whoAmI(GAGenome &) { return static_cast<float>(getpid()); }
+
+// takes the process down for genomes that start with two ones
+float crashy(GAGenome &g)
+{
+	auto &genome = dynamic_cast<GA1DBinaryStringGenome &>(g);
+	if (genome.gene(0) == 1 && genome.gene(1) == 1)
+	{
+		_exit(1);
+	}
+	return countOnes(g);
+}
+
+float ones(const GAGenome &g)
+{
+	auto &genome = dynamic_cast<const GA1DBinaryStringGenome &>(g);
+	float score = 0.0;
+	for (int i = 0; i < genome.length(); i++)
+	{
+		score += genome.gene(i);
+	}
+	return score;
+}
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(UnitTest)
+
+BOOST_AUTO_TEST_CASE(ProcessPool_001)
+{
+	GA1DBinaryStringGenome genome(32, countOnes);
+	{
+		GAProcessPool pool(genome, 3, 4);
+		BOOST_CHECK_EQUAL(pool.size(), 3U);
+		BOOST_CHECK_EQUAL(pool.batchSize(), 4U);
+		BOOST_CHECK(GAProcessPool::current() == &pool);
+
+		GAPopulation pop(genome, 41);
+		pop.evaluator(GAPopulation::ProcessEvaluator);
+		GAResetRNG(7);
+		pop.initialize();
+		ncalls = 0;
+		pop.evaluate();
+		BOOST_CHECK_EQUAL(ncalls, 0); // all of them in the workers
+		for (int i = 0; i < pop.size(); i++)
+		{
+			BOOST_CHECK(pop.individual(i).evaluated());
+			BOOST_CHECK_EQUAL(pop.individual(i).score(), ones(pop.individual(i)));
+			BOOST_CHECK_EQUAL(pop.individual(i).nevals(), 1);
+		}
+
+		// the workers are other processes, and all of them get work
+		GA1DBinaryStringGenome pids(8, whoAmI);
+		GAProcessPool other(pids, 2, 1);
+		BOOST_CHECK(GAProcessPool::current() == &other);
+		GAPopulation who(pids, 20);
+		who.evaluator(GAPopulation::ProcessEvaluator);
+		who.initialize();
+		who.evaluate();
+		std::set<float> seen;
+		for (int i = 0; i < who.size(); i++)
+		{
+			seen.insert(who.individual(i).score());
+		}
+		BOOST_CHECK(seen.count(static_cast<float>(getpid())) == 0);
+		BOOST_CHECK(seen.size() <= 2U);
+		BOOST_CHECK_EQUAL(pool.restarts(), 0UL);
+	}
+	BOOST_CHECK(GAProcessPool::current() == nullptr);
+
+	// a GA gets the same result as with the default evaluator
+	float best[2], online[2];
+	for (int k = 0; k < 2; k++)
+	{
+		GAProcessPool pool(genome, 2);
+		GAPopulation pop(genome, 30);
+		if (k == 1)
+		{
+			pop.evaluator(GAPopulation::ProcessEvaluator);
+		}
+		GASimpleGA ga(pop);
+		ga.nGenerations(20);
+		ga.pMutation(0.01);
+		GAResetRNG(9);
+		ga.evolve();
+		best[k] = ga.statistics().bestIndividual().score();
+		online[k] = ga.statistics().online();
+	}
+	BOOST_CHECK_EQUAL(best[0], best[1]);
+	BOOST_CHECK_EQUAL(online[0], online[1]);
+}
+
+BOOST_AUTO_TEST_CASE(ProcessPool_002)
+{
+	// workers that die are replaced, and only the genome that kills them is
+	// given up on
+	GA1DBinaryStringGenome genome(16, crashy);
+	GAProcessPool pool(genome, 2, 4);
+	GAPopulation pop(genome, 24);
+	pop.evaluator(GAPopulation::ProcessEvaluator);
+	GAResetRNG(3);
+	pop.initialize();
+	auto &poison = dynamic_cast<GA1DBinaryStringGenome &>(pop.individual(5));
+	poison.gene(0, 1);
+	poison.gene(1, 1);
+	int npoison = 0;
+	for (int i = 0; i < pop.size(); i++)
+	{
+		auto &g = dynamic_cast<GA1DBinaryStringGenome &>(pop.individual(i));
+		npoison += (g.gene(0) == 1 && g.gene(1) == 1);
+	}
+	pop.evaluate();
+
+	float worst = 1000.0;
+	for (int i = 0; i < pop.size(); i++)
+	{
+		auto &g = dynamic_cast<GA1DBinaryStringGenome &>(pop.individual(i));
+		if (g.gene(0) == 0 || g.gene(1) == 0)
+		{
+			BOOST_CHECK_EQUAL(g.score(), ones(g));
+			worst = std::min(worst, g.score());
+		}
+	}
+	for (int i = 0; i < pop.size(); i++)
+	{
+		auto &g = dynamic_cast<GA1DBinaryStringGenome &>(pop.individual(i));
+		if (g.gene(0) == 1 && g.gene(1) == 1)
+		{
+			BOOST_CHECK_EQUAL(g.score(), worst);
+			BOOST_CHECK_EQUAL(g.nevals(), 0);
+		}
+	}
+	BOOST_CHECK(pool.restarts() >= 2UL * npoison); // two of the three alone
+	BOOST_CHECK_EQUAL(pool.size(), 2U);
+
+	// and the pool carries on
+	for (int i = 0; i < pop.size(); i++)
+	{
+		auto &g = dynamic_cast<GA1DBinaryStringGenome &>(pop.individual(i));
+		g.gene(0, 0);
+	}
+	unsigned long int restarts = pool.restarts();
+	pop.evaluate(true);
+	for (int i = 0; i < pop.size(); i++)
+	{
+		BOOST_CHECK_EQUAL(pop.individual(i).score(), ones(pop.individual(i)));
+	}
+	BOOST_CHECK_EQUAL(pool.restarts(), restarts);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif
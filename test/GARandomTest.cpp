@@ -0,0 +1,159 @@
+#include <boost/test/unit_test.hpp>
+
+#include <GA1DBinStrGenome.h>
+#include <garandom.h>
+
+#include <climits>
+#include <cstdint>
+#include <cmath>
+#include <thread>
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(UnitTest)
+
+BOOST_AUTO_TEST_CASE(GARandomStream_001)
+{
+	GARandomStream s1(42);
+	GARandomStream s2(42);
+	GARandomStream s3(43);
+	bool differs = false;
+	for (int i = 0; i < 100; i++)
+	{
+		std::uint64_t v = s1.next();
+		BOOST_CHECK_EQUAL(v, s2.next());
+		differs = differs || (v != s3.next());
+
+		float f = s1.randomFloat();
+		s2.randomFloat();
+		BOOST_CHECK(0.0f <= f && f < 1.0f);
+
+		int r = s1.randomInt(-3, 3);
+		s2.randomInt(-3, 3);
+		BOOST_CHECK(-3 <= r && r <= 3);
+	}
+	BOOST_CHECK(differs);
+}
+
+BOOST_AUTO_TEST_CASE(GARandomStream_substream)
+{
+	GARandomStream master(7);
+	GARandomStream a = master.substream(0);
+	GARandomStream b = master.substream(1);
+	GARandomStream c = master;
+	c.jump();
+
+	BOOST_CHECK_EQUAL(a.next(), c.next());
+	BOOST_CHECK(a.next() != b.next());
+}
+
+BOOST_AUTO_TEST_CASE(GARandomStream_scope)
+{
+	GARandomStream s(99);
+	GARandomStream ref(99);
+
+	BOOST_CHECK(GAThreadRandomStream() == nullptr);
+	{
+		GARandomStreamScope scope(s);
+		BOOST_CHECK(GAThreadRandomStream() == &s);
+		for (int i = 0; i < 10; i++)
+		{
+			BOOST_CHECK_EQUAL(GARandomInt(0, 1000), ref.randomInt(0, 1000));
+			BOOST_CHECK_EQUAL(GARandomFloat(), ref.randomFloat());
+			BOOST_CHECK_EQUAL(GAUnitGaussian(), ref.unitGaussian());
+		}
+	}
+	BOOST_CHECK(GAThreadRandomStream() == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(GARandomStream_threads)
+{
+	GARandomStream master(2020);
+	std::vector<std::vector<int>> draws(4);
+	std::vector<std::thread> threads;
+	for (unsigned int t = 0; t < draws.size(); t++)
+	{
+		threads.emplace_back([&, t] {
+			GARandomStream s = master.substream(t);
+			GARandomStreamScope scope(s);
+			for (int i = 0; i < 1000; i++)
+			{
+				draws[t].push_back(GARandomInt(0, 1 << 20));
+			}
+		});
+	}
+	for (auto &t : threads)
+	{
+		t.join();
+	}
+
+	for (unsigned int t = 0; t < draws.size(); t++)
+	{
+		GARandomStream s = master.substream(t);
+		for (int v : draws[t])
+		{
+			BOOST_CHECK_EQUAL(v, s.randomInt(0, 1 << 20));
+		}
+	}
+}
+
+BOOST_AUTO_TEST_CASE(GARandomSkip_001)
+{
+	// the gaps are geometric: P(k) = p (1-p)^k, with mean (1-p)/p
+	GAResetRNG(17);
+	const float p = 0.05F;
+	const int n = 40000;
+	double sum = 0.0;
+	int zeros = 0;
+	for (int i = 0; i < n; i++)
+	{
+		int k = GARandomSkip(p);
+		BOOST_REQUIRE(k >= 0);
+		sum += k;
+		zeros += (k == 0 ? 1 : 0);
+	}
+	double mean = (1.0 - p) / p;
+	double sd = std::sqrt((1.0 - p) / (p * p) / n);
+	BOOST_CHECK(std::fabs(sum / n - mean) < 5 * sd);
+	BOOST_CHECK(std::fabs(zeros - n * p) < 5 * std::sqrt(n * p * (1.0 - p)));
+
+	BOOST_CHECK_EQUAL(GARandomSkip(1.0F), 0);
+	BOOST_CHECK_EQUAL(GARandomSkip(0.0F), INT_MAX - 1);
+}
+
+BOOST_AUTO_TEST_CASE(GARandomSkip_002)
+{
+	// a flip mutator at a low rate flips as many bits as a coin for each would,
+	// and reports the ones it flipped
+	GAResetRNG(23);
+	const int length = 200000;
+	const float pmut = 2.0e-6F;
+	GA1DBinaryStringGenome genome(length), before(length);
+	int total = 0;
+	const int calls = 2000;
+	for (int c = 0; c < calls; c++)
+	{
+		before.copy(genome);
+		int n = GA1DBinaryStringGenome::FlipMutator(genome, pmut);
+		BOOST_CHECK_EQUAL(genome.hamming(before), n);
+		total += n;
+	}
+	double mean = static_cast<double>(calls) * length * pmut;
+	BOOST_CHECK(std::fabs(total - mean) < 5 * std::sqrt(mean));
+}
+
+BOOST_AUTO_TEST_CASE(GARandomBits_001)
+{
+	// without a stream the words come from the main generator, so seeds that
+	// only differ above the low 18 bits (which are all the single-bit
+	// generator looks at) still give different words
+	GAResetRNG(262144);
+	std::uint64_t a = GARandomBits(64);
+	std::uint64_t b = GARandomBits(64);
+	BOOST_CHECK(a != 0 && b != 0 && a != b);
+	BOOST_CHECK(a >> 40 != 0);
+	GAResetRNG(2 * 262144);
+	BOOST_CHECK(GARandomBits(64) != a);
+	BOOST_CHECK(GARandomBits(5) < 32);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,148 @@
+#include <boost/test/unit_test.hpp>
+
+#include <GARealGenome.h>
+#include <garandom.h>
+
+#include <cstring>
+
+BOOST_AUTO_TEST_SUITE(UnitTest)
+
+BOOST_AUTO_TEST_CASE(GARealGenome_001)
+{
+	// double genomes keep what a float cannot
+	GADoubleAlleleSet alleles(0.0, 1.0);
+	GADoubleGenome genome(4, alleles);
+	BOOST_CHECK_EQUAL(std::strcmp(genome.className(), "GADoubleGenome"), 0);
+	BOOST_CHECK_EQUAL(genome.classID(), GAID::DoubleGenome);
+
+	double tiny = 1.0 + 1.0e-12;
+	genome.gene(2, tiny);
+	BOOST_CHECK_EQUAL(genome.gene(2), tiny);
+	BOOST_CHECK_EQUAL(genome.genes()[2], tiny);
+
+	GADoubleGenome copy(genome);
+	BOOST_CHECK(copy.equal(genome));
+
+	GARealGenome floats(4, GARealAlleleSet(0.0F, 1.0F));
+	BOOST_CHECK_EQUAL(std::strcmp(floats.className(), "GARealGenome"), 0);
+}
+
+BOOST_AUTO_TEST_CASE(GARealGenome_002)
+{
+	// the gaussian mutator keeps genes within their bounds, and only changes
+	// the ones it picks
+	GAResetRNG(11);
+	GADoubleGenome genome(200, GADoubleAlleleSet(-1.0, 1.0));
+	genome.initialize();
+	GADoubleGenome before(genome);
+
+	int n = GARealGaussianMutator<double>(genome, 0.05);
+	int changed = 0;
+	for (int i = 0; i < genome.length(); i++)
+	{
+		BOOST_CHECK(genome.gene(i) >= -1.0 && genome.gene(i) <= 1.0);
+		changed += (genome.gene(i) != before.gene(i) ? 1 : 0);
+	}
+	BOOST_CHECK(n > 0);
+	BOOST_CHECK(changed <= n);
+
+	n = genome.mutate(1.0);
+	BOOST_CHECK_EQUAL(n, genome.length());
+	for (int i = 0; i < genome.length(); i++)
+	{
+		BOOST_CHECK(genome.gene(i) >= -1.0 && genome.gene(i) <= 1.0);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(GARealGenome_003)
+{
+	// blend children lie within half the distance of the parents beyond them,
+	// and arithmetic children are the average
+	GAResetRNG(5);
+	GADoubleAlleleSet alleles(-10.0, 10.0);
+	GADoubleGenome mom(64, alleles), dad(64, alleles);
+	GADoubleGenome sis(64, alleles), bro(64, alleles);
+	mom.initialize();
+	dad.initialize();
+
+	BOOST_CHECK_EQUAL(GARealBlendCrossover<double>(mom, dad, &sis, &bro), 2);
+	for (int i = 0; i < mom.length(); i++)
+	{
+		double lo = GAMin(mom.gene(i), dad.gene(i));
+		double hi = GAMax(mom.gene(i), dad.gene(i));
+		double d = 0.5 * (hi - lo);
+		BOOST_CHECK(sis.gene(i) >= lo - d && sis.gene(i) <= hi + d);
+		BOOST_CHECK(bro.gene(i) >= lo - d && bro.gene(i) <= hi + d);
+	}
+
+	GADoubleGenome shorter(16, alleles);
+	shorter.initialize();
+	BOOST_CHECK_EQUAL(
+		GARealArithmeticCrossover<double>(mom, shorter, &sis, nullptr), 1);
+	for (int i = 0; i < shorter.length(); i++)
+	{
+		BOOST_CHECK_EQUAL(sis.gene(i), 0.5 * (mom.gene(i) + shorter.gene(i)));
+	}
+
+	// the float operators are the defaults
+	GARealAlleleSet reals(-10.0F, 10.0F);
+	GARealGenome a(8, reals), b(8, reals), c(8, reals);
+	a.initialize();
+	b.initialize();
+	BOOST_CHECK_EQUAL(GARealArithmeticCrossover(a, b, &c, nullptr), 1);
+	BOOST_CHECK_EQUAL(c.gene(3), 0.5F * (a.gene(3) + b.gene(3)));
+}
+
+BOOST_AUTO_TEST_CASE(GARealGenome_004)
+{
+	// a genome with one allele set gets all its alleles at once, and they are
+	// the ones a call to allele() for each gene would have picked
+	GADoubleAlleleSet bounded(-1.0, 1.0, GAAllele::BoundType::EXCLUSIVE,
+							  GAAllele::BoundType::INCLUSIVE);
+	GADoubleAlleleSet discrete(0.0, 10.0, 0.5);
+	GADoubleAlleleSet enumerated;
+	enumerated.add(3.0);
+	enumerated.add(5.0);
+	enumerated.add(7.0);
+	for (const GADoubleAlleleSet &s : {bounded, discrete, enumerated})
+	{
+		GADoubleAlleleSetArray twice(s);
+		twice.add(s);
+		GADoubleGenome genome(50, s), each(twice);
+		each.resize(50);
+		GAResetRNG(19);
+		genome.initialize();
+		GAResetRNG(19);
+		each.initialize();
+		BOOST_CHECK(genome.equal(each));
+
+		GADoubleGenome before(genome);
+		genome.mutate(0.2);
+		for (int i = 0; i < genome.length(); i++)
+		{
+			if (genome.gene(i) != before.gene(i))
+			{
+				double x = genome.gene(i);
+				BOOST_CHECK(x >= -1.0 && x <= 10.0);
+				if (s.type() != GAAllele::Type::BOUNDED)
+				{
+					BOOST_CHECK_EQUAL(x, 0.5 * static_cast<int>(2.0 * x));
+				}
+			}
+		}
+	}
+
+	// the float sets do the same
+	GARealAlleleSet steps(1.0F, 2.0F, 0.25F);
+	GARealAlleleSetArray both(steps);
+	both.add(steps);
+	GARealGenome floats(30, steps), each(both);
+	each.resize(30);
+	GAResetRNG(2);
+	GARealGenome::UniformInitializer(floats);
+	GAResetRNG(2);
+	GARealGenome::UniformInitializer(each);
+	BOOST_CHECK(floats.equal(each));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,192 @@
+#include <boost/test/unit_test.hpp>
+
+#include <GA1DBinStrGenome.h>
+#include <GAPopulation.h>
+#include <GASelector.h>
+#include <garandom.h>
+#include <vector>
+
+namespace
+{
+float countOnes(GAGenome &g)
+{
+	auto &genome = dynamic_cast<GA1DBinaryStringGenome &>(g);
+	float score = 0;
+	for (int i = 0; i < genome.length(); i++)
+	{
+		score += genome.gene(i);
+	}
+	return score;
+}
+
+// Fraction of count selections that picked each individual.
+std::vector<double> frequencies(const GARouletteWheelSelector &sel, int n,
+								unsigned int count)
+{
+	std::vector<unsigned int> idx(count);
+	sel.selectN(idx.data(), count);
+	std::vector<double> freq(n, 0.0);
+	for (unsigned int i : idx)
+	{
+		BOOST_REQUIRE(i < static_cast<unsigned int>(n));
+		freq[i] += 1.0 / count;
+	}
+	return freq;
+}
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(UnitTest)
+
+BOOST_AUTO_TEST_CASE(RouletteWheel_001)
+{
+	GA1DBinaryStringGenome genome(16, countOnes);
+	GAResetRNG(21);
+	GAPopulation pop(genome, 20);
+	pop.initialize();
+	pop.evaluate(true);
+
+	double sum = 0.0;
+	for (int i = 0; i < pop.size(); i++)
+	{
+		sum += pop.individual(i).score();
+	}
+
+	GARouletteWheelSelector sel(GASelectionScheme::RAW);
+	sel.assign(pop);
+	sel.update();
+
+	// the chance of picking each individual is proportional to its score
+	std::vector<double> freq = frequencies(sel, pop.size(), 200000);
+	for (int i = 0; i < pop.size(); i++)
+	{
+		BOOST_CHECK_SMALL(freq[i] - pop.individual(i).score() / sum, 0.005);
+	}
+
+	// select() draws from the same wheel
+	std::vector<double> sfreq(pop.size(), 0.0);
+	for (int k = 0; k < 100000; k++)
+	{
+		GAGenome &g = sel.select();
+		for (int i = 0; i < pop.size(); i++)
+		{
+			if (&pop.individual(i) == &g)
+			{
+				sfreq[i] += 1.0 / 100000;
+			}
+		}
+	}
+	for (int i = 0; i < pop.size(); i++)
+	{
+		BOOST_CHECK_SMALL(sfreq[i] - pop.individual(i).score() / sum, 0.007);
+	}
+
+	// a copy picks the same way
+	GARouletteWheelSelector copy(sel);
+	freq = frequencies(copy, pop.size(), 200000);
+	for (int i = 0; i < pop.size(); i++)
+	{
+		BOOST_CHECK_SMALL(freq[i] - pop.individual(i).score() / sum, 0.005);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(RouletteWheel_002)
+{
+	GA1DBinaryStringGenome genome(16, countOnes);
+	GAResetRNG(22);
+	GAPopulation pop(genome, 10);
+	pop.initialize();
+	pop.evaluate(true);
+	pop.order(GAPopulation::LOW_IS_BEST);
+
+	double sum = 0.0;
+	for (int i = 0; i < pop.size(); i++)
+	{
+		sum += -pop.individual(i).score() + pop.max() + pop.min();
+	}
+
+	GARouletteWheelSelector sel(GASelectionScheme::RAW);
+	sel.assign(pop);
+	sel.update();
+
+	// low is best flips the weights around
+	std::vector<double> freq = frequencies(sel, pop.size(), 200000);
+	for (int i = 0; i < pop.size(); i++)
+	{
+		double w = -pop.individual(i).score() + pop.max() + pop.min();
+		BOOST_CHECK_SMALL(freq[i] - w / sum, 0.005);
+	}
+
+	// the tournament picks the better of two spins
+	GATournamentSelector tsel(GASelectionScheme::RAW);
+	tsel.assign(pop);
+	tsel.update();
+	std::vector<double> tfreq = frequencies(tsel, pop.size(), 200000);
+	for (int i = 0; i < pop.size(); i++)
+	{
+		double s = pop.individual(i).score();
+		double better = 0.0; // chance a single spin beats (or ties) i
+		double same = 0.0;
+		for (int j = 0; j < pop.size(); j++)
+		{
+			double w = (-pop.individual(j).score() + pop.max() + pop.min()) / sum;
+			if (pop.individual(j).score() < s)
+			{
+				better += w;
+			}
+			else if (j != i && pop.individual(j).score() == s)
+			{
+				same += w;
+			}
+		}
+		// i wins if the first spin is i and the second is not better, or
+		// if the second spin is i and the first is worse
+		double p = (-s + pop.max() + pop.min()) / sum;
+		double expect = p * (1.0 - better) + p * (1.0 - better - same - p);
+		BOOST_CHECK_SMALL(tfreq[i] - expect, 0.006);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(SelectBatch_001)
+{
+	GA1DBinaryStringGenome genome(16, countOnes);
+	GAResetRNG(23);
+	GAPopulation pop(genome, 30);
+	pop.initialize();
+	pop.evaluate(true);
+
+	GARankSelector rank;
+	GARouletteWheelSelector roulette;
+	GATournamentSelector tournament;
+	GAUniformSelector uniform;
+	GASRSSelector srs;
+	GADSSelector ds;
+	std::vector<GASelectionScheme *> selectors = {&rank,		&roulette,
+												  &tournament, &uniform,
+												  &srs,		&ds};
+
+	std::vector<GAGenome *> out(1001);
+	for (GASelectionScheme *sel : selectors)
+	{
+		pop.selector(*sel);
+		pop.selectBatch(out.size(), out.data());
+		for (GAGenome *g : out)
+		{
+			bool found = false;
+			for (int i = 0; i < pop.size(); i++)
+			{
+				found = found || (&pop.individual(i) == g);
+			}
+			BOOST_CHECK(found);
+		}
+	}
+
+	// the rank selector only ever picks the best
+	pop.selector(rank);
+	pop.selectBatch(out.size(), out.data());
+	for (GAGenome *g : out)
+	{
+		BOOST_CHECK_EQUAL(g->fitness(), pop.best().fitness());
+	}
+}
+
+BOOST_AUTO_TEST_SUITE_END()